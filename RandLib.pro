@@ -14,6 +14,7 @@ DEFINES += RANDLIB_LIBRARY
 SOURCES += \
     distributions/ProbabilityDistribution.cpp \
     distributions/univariate/BasicRandGenerator.cpp \
+    distributions/univariate/QuasiRandGenerator.cpp \
     distributions/univariate/continuous/BetaRand.cpp \
     distributions/univariate/continuous/CauchyRand.cpp \
     distributions/univariate/continuous/ExponentialRand.cpp \
@@ -48,6 +49,8 @@ SOURCES += \
     distributions/univariate/continuous/circular/VonMisesRand.cpp \
     distributions/univariate/continuous/SechRand.cpp \
     distributions/univariate/continuous/WignerSemicircleRand.cpp \
+    distributions/univariate/continuous/NumericalInversionRand.cpp \
+    distributions/univariate/continuous/TransformedDensityRejection.cpp \
     distributions/univariate/continuous/GumbelRand.cpp \
     distributions/univariate/discrete/LogarithmicRand.cpp \
     distributions/univariate/discrete/ZetaRand.cpp \
@@ -56,6 +59,7 @@ SOURCES += \
     distributions/univariate/continuous/RaisedCosineRand.cpp \
     distributions/univariate/continuous/FrechetRand.cpp \
     distributions/univariate/discrete/SkellamRand.cpp \
+    distributions/univariate/discrete/TabulatedDiscreteRand.cpp \
     distributions/univariate/continuous/PlanckRand.cpp \
     distributions/univariate/continuous/IrwinHallRand.cpp \
     distributions/univariate/continuous/InverseGammaRand.cpp \
@@ -67,6 +71,7 @@ SOURCES += \
     distributions/univariate/discrete/NegativeHyperGeometricRand.cpp \
     distributions/univariate/continuous/InverseGaussianRand.cpp \
     distributions/univariate/discrete/CategoricalRand.cpp \
+    distributions/univariate/discrete/DynamicCategoricalRand.cpp \
     distributions/univariate/continuous/NoncentralChiSquaredRand.cpp \
     distributions/univariate/continuous/KolmogorovSmirnovRand.cpp \
     math/BetaMath.cpp \
@@ -85,9 +90,11 @@ SOURCES += \
 HEADERS +=\
     distributions/ProbabilityDistribution.h \
     distributions/univariate/BasicRandGenerator.h \
+    distributions/univariate/QuasiRandGenerator.h \
     distributions/univariate/continuous/BetaRand.h \
     distributions/univariate/continuous/CauchyRand.h \
     distributions/univariate/continuous/ExponentialRand.h \
+    distributions/univariate/continuous/ZigguratTables.h \
     distributions/univariate/continuous/GammaRand.h \
     distributions/univariate/continuous/LaplaceRand.h \
     distributions/univariate/continuous/LevyRand.h \
@@ -120,6 +127,8 @@ HEADERS +=\
     math/Constants.h \
     distributions/univariate/continuous/SechRand.h \
     distributions/univariate/continuous/WignerSemicircleRand.h \
+    distributions/univariate/continuous/NumericalInversionRand.h \
+    distributions/univariate/continuous/TransformedDensityRejection.h \
     distributions/univariate/continuous/GumbelRand.h \
     distributions/univariate/discrete/LogarithmicRand.h \
     distributions/univariate/discrete/ZetaRand.h \
@@ -128,6 +137,7 @@ HEADERS +=\
     distributions/univariate/continuous/RaisedCosineRand.h \
     distributions/univariate/continuous/FrechetRand.h \
     distributions/univariate/discrete/SkellamRand.h \
+    distributions/univariate/discrete/TabulatedDiscreteRand.h \
     distributions/univariate/continuous/PlanckRand.h \
     distributions/univariate/continuous/IrwinHallRand.h \
     distributions/univariate/continuous/InverseGammaRand.h \
@@ -141,6 +151,7 @@ HEADERS +=\
     distributions/univariate/discrete/NegativeHyperGeometricRand.h \
     distributions/univariate/continuous/InverseGaussianRand.h \
     distributions/univariate/discrete/CategoricalRand.h \
+    distributions/univariate/discrete/DynamicCategoricalRand.h \
     distributions/univariate/continuous/NoncentralChiSquaredRand.h \
     distributions/univariate/continuous/KolmogorovSmirnovRand.h \
     math/BetaMath.h \
@@ -0,0 +1,59 @@
+#include "RandLib.h"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+/**
+ * Micro-benchmark of basic generators:
+ * reports time per word and throughput of random bits
+ * for word-by-word generation and for bulk filling of buffer
+ */
+
+static constexpr size_t BUFFER_SIZE = 1 << 16;
+static constexpr size_t REPETITIONS = 512;
+
+template < char Generator >
+void benchmark(const String &name)
+{
+    typedef std::chrono::steady_clock Clock;
+    BasicRandGenerator<Generator> engine(20170101);
+    std::vector<unsigned long long> buffer(BUFFER_SIZE);
+    /// significant bytes in one word
+    double wordSize = (BasicRandGenerator<Generator>::maxDecimals() >> 3);
+    double words = static_cast<double>(BUFFER_SIZE) * REPETITIONS;
+
+    Clock::time_point start = Clock::now();
+    for (size_t r = 0; r != REPETITIONS; ++r) {
+        for (unsigned long long & var : buffer)
+            var = engine.Next();
+    }
+    double nextTime = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    start = Clock::now();
+    for (size_t r = 0; r != REPETITIONS; ++r)
+        engine.Fill(buffer.data(), buffer.size());
+    double fillTime = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    /// use output, so that it can't be optimized away
+    unsigned long long checksum = 0;
+    for (unsigned long long var : buffer)
+        checksum ^= var;
+
+    std::cout << std::setw(14) << name << std::fixed << std::setprecision(3)
+              << std::setw(12) << nextTime / words << " ns/word"
+              << std::setw(10) << wordSize * words / nextTime << " GB/s"
+              << std::setw(12) << fillTime / words << " ns/word"
+              << std::setw(10) << wordSize * words / fillTime << " GB/s"
+              << "   (checksum " << std::hex << checksum << std::dec << ")\n";
+}
+
+int main()
+{
+    std::cout << std::setw(14) << "Generator" << std::setw(35) << "Next()" << std::setw(35) << "Fill()" << "\n";
+    benchmark<JKISS>("JKISS");
+    benchmark<JLKISS64>("JLKISS64");
+    benchmark<PHILOX4x32>("Philox4x32-10");
+    benchmark<XOSHIRO256PP>("xoshiro256++");
+    benchmark<PCG64DXSM>("PCG64-DXSM");
+    return 0;
+}
@@ -0,0 +1,11 @@
+TEMPLATE = app
+TARGET = GeneratorBenchmark
+CONFIG += console c++17
+CONFIG -= qt app_bundle
+QMAKE_CXXFLAGS += -std=c++17 -O2
+
+INCLUDEPATH += ..
+LIBS += -L../../bin/RandLib -lRandLib
+
+SOURCES += \
+    GeneratorBenchmark.cpp
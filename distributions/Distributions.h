@@ -3,6 +3,7 @@
 
 #include "ProbabilityDistribution.h"
 #include "univariate/BasicRandGenerator.h"
+#include "univariate/QuasiRandGenerator.h"
 
 /// UNIVARIATE
 #include "univariate/UnivariateDistribution.h"
@@ -32,12 +33,14 @@
 #include "univariate/continuous/NakagamiRand.h"
 #include "univariate/continuous/NoncentralChiSquaredRand.h"
 #include "univariate/continuous/NormalRand.h"
+#include "univariate/continuous/NumericalInversionRand.h"
 #include "univariate/continuous/ParetoRand.h"
 #include "univariate/continuous/PlanckRand.h"
 #include "univariate/continuous/RaisedCosineRand.h"
 #include "univariate/continuous/SechRand.h"
 #include "univariate/continuous/StableRand.h"
 #include "univariate/continuous/StudentTRand.h"
+#include "univariate/continuous/TransformedDensityRejection.h"
 #include "univariate/continuous/UniformRand.h"
 #include "univariate/continuous/TriangularRand.h"
 #include "univariate/continuous/WeibullRand.h"
@@ -53,6 +56,7 @@
 #include "univariate/discrete/BetaBinomialRand.h"
 #include "univariate/discrete/BinomialRand.h"
 #include "univariate/discrete/CategoricalRand.h"
+#include "univariate/discrete/DynamicCategoricalRand.h"
 #include "univariate/discrete/GeometricRand.h"
 #include "univariate/discrete/HyperGeometricRand.h"
 #include "univariate/discrete/NegativeBinomialRand.h"
@@ -61,6 +65,7 @@
 #include "univariate/discrete/PoissonRand.h"
 #include "univariate/discrete/RademacherRand.h"
 #include "univariate/discrete/SkellamRand.h"
+#include "univariate/discrete/TabulatedDiscreteRand.h"
 #include "univariate/discrete/UniformDiscreteRand.h"
 #include "univariate/discrete/YuleRand.h"
 #include "univariate/discrete/ZetaRand.h"
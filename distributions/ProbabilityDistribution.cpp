@@ -22,6 +22,20 @@ void ProbabilityDistribution<T>::Sample(std::vector<T> &outputData) const
         var = this->Variate();
 }
 
+template < typename T >
+T ProbabilityDistribution<T>::Variate(RandGenerator &engine) const
+{
+    RandGenerator::Scope scope(engine);
+    return this->Variate();
+}
+
+template < typename T >
+void ProbabilityDistribution<T>::Sample(RandGenerator &engine, std::vector<T> &outputData) const
+{
+    RandGenerator::Scope scope(engine);
+    this->Sample(outputData);
+}
+
 template < typename T >
 void ProbabilityDistribution<T>::CumulativeDistributionFunction(const std::vector<T> &x, std::vector<double> &y) const
 {
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "math/RandMath.h"
+#include "univariate/BasicRandGenerator.h"
 #include "RandLib_global.h"
 
 /**
@@ -58,6 +59,20 @@ public:
      */
     virtual void Sample(std::vector<T> &outputData) const;
 
+    /**
+     * @fn Variate
+     * @param engine
+     * @return random variable, generated by given engine
+     */
+    T Variate(RandGenerator &engine) const;
+
+    /**
+     * @fn Sample
+     * @param engine
+     * @param outputData, generated by given engine
+     */
+    void Sample(RandGenerator &engine, std::vector<T> &outputData) const;
+
     /**
      * @fn F
      * @param x
@@ -70,7 +85,7 @@ public:
      * @param x input vector
      * @param y output vector: y = P(X ≤ x)
      */
-    void CumulativeDistributionFunction(const std::vector<T> &x, std::vector<double> &y) const;
+    virtual void CumulativeDistributionFunction(const std::vector<T> &x, std::vector<double> &y) const;
 
     /**
      * @fn S
@@ -36,6 +36,7 @@ public:
     double f(const DoublePair &point) const override;
     double logf(const DoublePair &point) const override;
     double F(const DoublePair & point) const override;
+    using ContinuousBivariateDistribution<NormalRand, NormalRand>::Variate;
     DoublePair Variate() const override;
 
     double Correlation() const override;
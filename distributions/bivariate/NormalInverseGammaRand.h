@@ -32,6 +32,7 @@ public:
     double f(const DoublePair &point) const override;
     double logf(const DoublePair &point) const override;
     double F(const DoublePair & point) const override;
+    using ContinuousBivariateDistribution<StudentTRand, InverseGammaRand>::Variate;
     DoublePair Variate() const override;
 
     double Correlation() const override;
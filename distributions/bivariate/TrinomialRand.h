@@ -31,6 +31,7 @@ public:
     double P(const IntPair &point) const override;
     double logP(const IntPair &point) const override;
     double F(const IntPair & point) const override;
+    using DiscreteBivariateDistribution<BinomialRand, BinomialRand>::Variate;
     IntPair Variate() const override;
 
     double Correlation() const override;
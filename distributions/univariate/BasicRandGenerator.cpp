@@ -1,50 +1,1046 @@
 #include "BasicRandGenerator.h"
+#include <atomic>
+#include <utility>
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+/**
+ * @fn splitMix64
+ * @param x
+ * @return next value of SplitMix64 sequence, used to spread one seed over the whole state
+ */
+static unsigned long long splitMix64(unsigned long long &x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief The LCGJump struct
+ * n-th power of linear congruential generator x -> a * x + c mod 2^k
+ */
+template < typename UIntType >
+struct LCGJump
+{
+    UIntType A = 1, C = 0;
+
+    LCGJump(UIntType a, UIntType c, unsigned long long n)
+    {
+        /// (A, C) is obtained from affine map (a, c) by repeated squaring
+        while (n != 0) {
+            if (n & 1) {
+                A *= a;
+                C = C * a + c;
+            }
+            c *= (a + 1);
+            a *= a;
+            n >>= 1;
+        }
+    }
+
+    void operator()(UIntType &x) const
+    {
+        x = A * x + C;
+    }
+};
+
+/**
+ * @brief The XorshiftJump struct
+ * n-th power of xorshift generator, which is linear map over GF(2)
+ */
+template < typename UIntType >
+struct XorshiftJump
+{
+    static constexpr size_t BITS = 8 * sizeof(UIntType);
+    UIntType columns[BITS]; ///< images of unit vectors
+
+    template < class Step >
+    XorshiftJump(Step step, unsigned long long n) : columns()
+    {
+        UIntType power[BITS], temp[BITS];
+        for (size_t i = 0; i != BITS; ++i) {
+            columns[i] = static_cast<UIntType>(1) << i;
+            power[i] = step(columns[i]);
+        }
+        while (n != 0) {
+            if (n & 1) {
+                for (size_t i = 0; i != BITS; ++i)
+                    columns[i] = apply(power, columns[i]);
+            }
+            for (size_t i = 0; i != BITS; ++i)
+                temp[i] = apply(power, power[i]);
+            std::copy(temp, temp + BITS, power);
+            n >>= 1;
+        }
+    }
+
+    static UIntType apply(const UIntType *matrix, UIntType v)
+    {
+        UIntType result = 0;
+        for (size_t i = 0; v != 0; ++i, v >>= 1) {
+            if (v & 1)
+                result ^= matrix[i];
+        }
+        return result;
+    }
+
+    void operator()(UIntType &y) const
+    {
+        y = apply(columns, y);
+    }
+};
+
+/**
+ * @fn mulMod
+ * @param a
+ * @param b
+ * @param m
+ * @return a * b mod m without overflow, given a, b < m
+ */
+static unsigned long long mulMod(unsigned long long a, unsigned long long b, unsigned long long m)
+{
+    unsigned long long result = 0;
+    while (b != 0) {
+        if (b & 1)
+            result = (result >= m - a) ? result - (m - a) : result + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return result;
+}
+
+/**
+ * @brief The MWCJump struct
+ * n-th power of multiply-with-carry generator with base 2^32.
+ * Value u = c * 2^32 + z follows multiplicative congruential generator
+ * u -> a * u mod (a * 2^32 - 1), hence it can be advanced by modular exponentiation
+ */
+struct MWCJump
+{
+    unsigned long long m, factor = 1;
+
+    MWCJump(unsigned long long a, unsigned long long n) : m((a << 32) - 1)
+    {
+        while (n != 0) {
+            if (n & 1)
+                factor = mulMod(factor, a, m);
+            a = mulMod(a, a, m);
+            n >>= 1;
+        }
+    }
+
+    void operator()(unsigned int &z, unsigned int &c) const
+    {
+        unsigned long long u = (static_cast<unsigned long long>(c) << 32) + z;
+        u = mulMod(u, factor, m);
+        z = u;
+        c = u >> 32;
+    }
+};
+
+/**
+ * @brief The KISSJump struct
+ * n-th power of KISS generator, combined from powers of its parts
+ */
+template < char Generator >
+struct KISSJump;
 
 template <>
-unsigned long long BasicRandGenerator<JLKISS64>::Variate()
+struct KISSJump<JKISS>
 {
-    static unsigned long long X = 123456789123ULL ^ time(0);
-    static unsigned long long Y = 987654321987ULL;
-    static unsigned int Z1 = 43219876;
-    static unsigned int Z2 = 6543217;
-    static unsigned int C1 = 21987643;
-    static unsigned int C2 = 1732654;
+    LCGJump<unsigned int> lcg;
+    XorshiftJump<unsigned int> xorshift;
+    MWCJump mwc;
+
+    explicit KISSJump(unsigned long long n) :
+        lcg(69069, 12345, n),
+        xorshift([] (unsigned int y) {
+            y ^= y << 13;
+            y ^= y >> 17;
+            y ^= y << 5;
+            return y;
+        }, n),
+        mwc(698769069ULL, n)
+    {}
+
+    void operator()(RandState<JKISS> &state) const
+    {
+        lcg(state.X);
+        xorshift(state.Y);
+        mwc(state.Z, state.C);
+    }
+};
+
+template <>
+struct KISSJump<JLKISS64>
+{
+    LCGJump<unsigned long long> lcg;
+    XorshiftJump<unsigned long long> xorshift;
+    MWCJump mwc1, mwc2;
+
+    explicit KISSJump(unsigned long long n) :
+        lcg(1490024343005336237ULL, 123456789, n),
+        xorshift([] (unsigned long long y) {
+            y ^= y << 21;
+            y ^= y >> 17;
+            y ^= y << 30;
+            return y;
+        }, n),
+        mwc1(4294584393ULL, n),
+        mwc2(4246477509ULL, n)
+    {}
+
+    void operator()(RandState<JLKISS64> &state) const
+    {
+        lcg(state.X);
+        xorshift(state.Y);
+        mwc1(state.Z1, state.C1);
+        mwc2(state.Z2, state.C2);
+    }
+};
+
+/**
+ * @brief The KISSLanes struct
+ * Several copies of KISS generator, stored by components,
+ * so that one step of all the lanes maps on SIMD instructions
+ */
+template < char Generator >
+struct KISSLanes;
+
+template <>
+struct KISSLanes<JKISS>
+{
+    static constexpr size_t LANES = 8; ///< amount of 32-bit lanes in 256-bit register
+    static constexpr size_t BLOCK = 512; ///< amount of consecutive variates, generated by one lane
+    unsigned int X[LANES], Y[LANES], Z[LANES], C[LANES];
+
+    void Load(size_t lane, const RandState<JKISS> &state)
+    {
+        X[lane] = state.X;
+        Y[lane] = state.Y;
+        Z[lane] = state.Z;
+        C[lane] = state.C;
+    }
+
+    void Generate(unsigned long long *output) const
+    {
+        /// local copies can't alias output, hence they stay in registers
+        unsigned int x[LANES], y[LANES], z[LANES], c[LANES];
+        std::copy(X, X + LANES, x);
+        std::copy(Y, Y + LANES, y);
+        std::copy(Z, Z + LANES, z);
+        std::copy(C, C + LANES, c);
+        for (size_t j = 0; j != BLOCK; ++j) {
+            for (size_t k = 0; k != LANES; ++k) {
+                unsigned long long t = 698769069ULL * z[k] + c[k];
+                x[k] = 69069 * x[k] + 12345;
+                y[k] ^= y[k] << 13;
+                y[k] ^= y[k] >> 17;
+                y[k] ^= y[k] << 5;
+                c[k] = t >> 32;
+                z[k] = t;
+                output[k * BLOCK + j] = x[k] + y[k] + z[k];
+            }
+        }
+    }
+};
+
+template <>
+struct KISSLanes<JLKISS64>
+{
+    static constexpr size_t LANES = 8; ///< amount of 64-bit lanes in 512-bit register
+    static constexpr size_t BLOCK = 512; ///< amount of consecutive variates, generated by one lane
+    unsigned long long X[LANES], Y[LANES];
+    unsigned int Z1[LANES], Z2[LANES], C1[LANES], C2[LANES];
+
+    void Load(size_t lane, const RandState<JLKISS64> &state)
+    {
+        X[lane] = state.X;
+        Y[lane] = state.Y;
+        Z1[lane] = state.Z1;
+        Z2[lane] = state.Z2;
+        C1[lane] = state.C1;
+        C2[lane] = state.C2;
+    }
+
+    void Generate(unsigned long long *output) const
+    {
+        /// local copies can't alias output, hence they stay in registers
+        unsigned long long x[LANES], y[LANES];
+        unsigned int z1[LANES], z2[LANES], c1[LANES], c2[LANES];
+        std::copy(X, X + LANES, x);
+        std::copy(Y, Y + LANES, y);
+        std::copy(Z1, Z1 + LANES, z1);
+        std::copy(Z2, Z2 + LANES, z2);
+        std::copy(C1, C1 + LANES, c1);
+        std::copy(C2, C2 + LANES, c2);
+        for (size_t j = 0; j != BLOCK; ++j) {
+            for (size_t k = 0; k != LANES; ++k) {
+                x[k] = 1490024343005336237ULL * x[k] + 123456789;
+                y[k] ^= y[k] << 21;
+                y[k] ^= y[k] >> 17;
+                y[k] ^= y[k] << 30;
+                unsigned long long t = 4294584393ULL * z1[k] + c1[k];
+                c1[k] = t >> 32;
+                z1[k] = t;
+                t = 4246477509ULL * z2[k] + c2[k];
+                c2[k] = t >> 32;
+                z2[k] = t;
+                output[k * BLOCK + j] = x[k] + y[k] + z1[k] + (static_cast<unsigned long long>(z2[k]) << 32);
+            }
+        }
+    }
+};
+
+/**
+ * @brief The PhiloxLanes struct
+ * Philox4x32-10 bijection, applied to LANES consecutive counters at once.
+ * Lanes are independent, hence one round of all the lanes maps on SIMD instructions
+ */
+template < size_t LANES >
+struct PhiloxLanes
+{
+    static constexpr size_t ROUNDS = 10;
+
+    /**
+     * @fn Generate
+     * @param key
+     * @param counter of the first block
+     * @param output 2 * LANES words
+     */
+    static void Generate(const unsigned int *key, const unsigned long long *counter, unsigned long long *output)
+    {
+        unsigned int c0[LANES], c1[LANES], c2[LANES], c3[LANES];
+        for (size_t k = 0; k != LANES; ++k) {
+            unsigned long long low = counter[0] + k;
+            unsigned long long high = counter[1] + (low < counter[0]);
+            c0[k] = low;
+            c1[k] = low >> 32;
+            c2[k] = high;
+            c3[k] = high >> 32;
+        }
+        unsigned int k0 = key[0], k1 = key[1];
+        for (size_t round = 0; round != ROUNDS; ++round) {
+            for (size_t k = 0; k != LANES; ++k) {
+                unsigned long long p0 = 0xD2511F53ULL * c0[k];
+                unsigned long long p1 = 0xCD9E8D57ULL * c2[k];
+                c0[k] = static_cast<unsigned int>(p1 >> 32) ^ c1[k] ^ k0;
+                c1[k] = p1;
+                c2[k] = static_cast<unsigned int>(p0 >> 32) ^ c3[k] ^ k1;
+                c3[k] = p0;
+            }
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        for (size_t k = 0; k != LANES; ++k) {
+            output[2 * k] = c0[k] | (static_cast<unsigned long long>(c1[k]) << 32);
+            output[2 * k + 1] = c2[k] | (static_cast<unsigned long long>(c3[k]) << 32);
+        }
+    }
+};
+
+/**
+ * @fn addToCounter
+ * @param counter 128-bit counter, low word goes first
+ * @param n
+ */
+static void addToCounter(unsigned long long *counter, unsigned long long n)
+{
+    counter[0] += n;
+    if (counter[0] < n)
+        ++counter[1];
+}
 
+/**
+ * @fn xoshiroStep
+ * move state of xoshiro256 engine one step forward
+ * @param s
+ */
+static inline void xoshiroStep(unsigned long long *s)
+{
+    unsigned long long t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+}
+
+/**
+ * @brief The XoshiroJump struct
+ * n-th power of xoshiro256 engine, which is linear map over GF(2)^256
+ */
+struct XoshiroJump
+{
+    static constexpr size_t WORDS = 4;
+    static constexpr size_t BITS = 64 * WORDS;
+    unsigned long long columns[BITS][WORDS]; ///< images of unit vectors
+
+    explicit XoshiroJump(unsigned long long n) : columns()
+    {
+        unsigned long long power[BITS][WORDS], temp[BITS][WORDS];
+        for (size_t i = 0; i != BITS; ++i) {
+            std::fill(columns[i], columns[i] + WORDS, 0);
+            columns[i][i >> 6] = 1ULL << (i & 63);
+            std::copy(columns[i], columns[i] + WORDS, power[i]);
+            xoshiroStep(power[i]);
+        }
+        while (n != 0) {
+            if (n & 1) {
+                for (size_t i = 0; i != BITS; ++i)
+                    Apply(power, columns[i]);
+            }
+            for (size_t i = 0; i != BITS; ++i) {
+                std::copy(power[i], power[i] + WORDS, temp[i]);
+                Apply(power, temp[i]);
+            }
+            std::copy(&temp[0][0], &temp[0][0] + BITS * WORDS, &power[0][0]);
+            n >>= 1;
+        }
+    }
+
+    static void Apply(const unsigned long long (*matrix)[WORDS], unsigned long long *v)
+    {
+        unsigned long long result[WORDS] = {0};
+        for (size_t w = 0; w != WORDS; ++w) {
+            unsigned long long word = v[w];
+            for (size_t i = 64 * w; word != 0; ++i, word >>= 1) {
+                if (word & 1) {
+                    for (size_t j = 0; j != WORDS; ++j)
+                        result[j] ^= matrix[i][j];
+                }
+            }
+        }
+        std::copy(result, result + WORDS, v);
+    }
+
+    void operator()(unsigned long long *s) const
+    {
+        Apply(columns, s);
+    }
+};
+
+/**
+ * @fn mulHigh
+ * @param a
+ * @param b
+ * @return upper 64 bits of 128-bit product a * b
+ */
+static inline unsigned long long mulHigh(unsigned long long a, unsigned long long b)
+{
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128;
+    return (static_cast<uint128>(a) * b) >> 64;
+#else
+    unsigned long long a0 = a & 0xFFFFFFFFULL, a1 = a >> 32;
+    unsigned long long b0 = b & 0xFFFFFFFFULL, b1 = b >> 32;
+    unsigned long long p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    unsigned long long middle = (p00 >> 32) + (p01 & 0xFFFFFFFFULL) + (p10 & 0xFFFFFFFFULL);
+    return p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+#endif
+}
+
+/**
+ * @brief The UInt128 struct
+ * Unsigned 128-bit number with arithmetic modulo 2^128, enough for PCG64-DXSM
+ */
+struct UInt128
+{
+    unsigned long long low, high;
+
+    UInt128(unsigned long long lowWord = 0, unsigned long long highWord = 0) : low(lowWord), high(highWord) {}
+
+    UInt128 operator+(const UInt128 &other) const
+    {
+        unsigned long long sum = low + other.low;
+        return UInt128(sum, high + other.high + (sum < low));
+    }
+
+    UInt128 operator*(const UInt128 &other) const
+    {
+        return UInt128(low * other.low, mulHigh(low, other.low) + low * other.high + high * other.low);
+    }
+
+    UInt128 &operator*=(const UInt128 &other)
+    {
+        return *this = *this * other;
+    }
+};
+
+/// multiplier of PCG64-DXSM, both for its LCG and output function
+static constexpr unsigned long long PCG_CHEAP_MULTIPLIER = 0xda942042e4dd58b5ULL;
+
+template < char Generator >
+thread_local BasicRandGenerator<Generator> BasicRandGenerator<Generator>::localEngine;
+
+template < char Generator >
+constexpr size_t BasicRandGenerator<Generator>::BUFFER_SIZE;
+
+template < char Generator >
+BasicRandGenerator<Generator>::BasicRandGenerator() : state(), buffer(), bufferState()
+{
+    /// different engines, created at the same time (for instance, in different threads) should differ
+    static std::atomic<unsigned long long> enginesCreated(0);
+    Seed(static_cast<unsigned long long>(time(0)) ^ (enginesCreated++ << 32));
+}
+
+template < char Generator >
+BasicRandGenerator<Generator>::BasicRandGenerator(unsigned long long seed) : state(), buffer(), bufferState()
+{
+    Seed(seed);
+}
+
+template <>
+void BasicRandGenerator<JLKISS64>::SeedState(unsigned long long seed)
+{
+    state.X = splitMix64(seed);
+    /// xorshift and multiply-with-carry generators shouldn't start from zero
+    do {
+        state.Y = splitMix64(seed);
+    } while (state.Y == 0);
+    do {
+        unsigned long long z = splitMix64(seed);
+        state.Z1 = z;
+        state.Z2 = z >> 32;
+    } while (state.Z1 == 0 || state.Z2 == 0);
+    unsigned long long c = splitMix64(seed);
+    state.C1 = (c & 0xFFFFFFFFULL) % 4294584393ULL;
+    state.C2 = (c >> 32) % 4246477509ULL;
+}
+
+template <>
+void BasicRandGenerator<JKISS>::SeedState(unsigned long long seed)
+{
+    unsigned long long x = splitMix64(seed);
+    state.X = x;
+    state.Y = x >> 32;
+    /// xorshift and multiply-with-carry generators shouldn't start from zero
+    while (state.Y == 0)
+        state.Y = splitMix64(seed);
+    unsigned long long z = splitMix64(seed);
+    state.Z = z;
+    while (state.Z == 0)
+        state.Z = splitMix64(seed);
+    state.C = (z >> 32) % 698769069ULL;
+}
+
+template <>
+void BasicRandGenerator<PHILOX4x32>::SeedState(unsigned long long seed)
+{
+    unsigned long long key = splitMix64(seed);
+    state.key[0] = key;
+    state.key[1] = key >> 32;
+    state.counter[0] = state.counter[1] = 0;
+    state.block[0] = state.block[1] = 0;
+    state.index = 2;
+}
+
+template <>
+void BasicRandGenerator<XOSHIRO256PP>::SeedState(unsigned long long seed)
+{
+    /// state of xoshiro shouldn't be all zeros
+    do {
+        for (unsigned long long & var : state.s)
+            var = splitMix64(seed);
+    } while ((state.s[0] | state.s[1] | state.s[2] | state.s[3]) == 0);
+}
+
+template <>
+void BasicRandGenerator<PCG64DXSM>::SeedState(unsigned long long seed)
+{
+    UInt128 initState(splitMix64(seed), splitMix64(seed));
+    UInt128 initSequence(splitMix64(seed), splitMix64(seed));
+    /// increment should be odd
+    UInt128 increment((initSequence.low << 1) | 1, (initSequence.high << 1) | (initSequence.low >> 63));
+    LCGJump<UInt128> step(PCG_CHEAP_MULTIPLIER, increment, 1);
+    UInt128 x;
+    step(x);
+    x = x + initState;
+    step(x);
+    state.state[0] = x.low;
+    state.state[1] = x.high;
+    state.increment[0] = increment.low;
+    state.increment[1] = increment.high;
+}
+
+template <>
+unsigned long long BasicRandGenerator<JLKISS64>::Step()
+{
     unsigned long long t;
 
-    X = 1490024343005336237ULL * X + 123456789;
-    Y ^= Y << 21;
-    Y ^= Y >> 17;
-    Y ^= Y << 30;
-    t = 4294584393ULL * Z1 + C1;
-    C1 = t >> 32;
-    Z1 = t;
-    t = 4246477509ULL * Z2 + C2;
-    C2 = t >> 32;
-    Z2 = t;
-    return X + Y + Z1 + (static_cast<unsigned long long>(Z2) << 32);
+    state.X = 1490024343005336237ULL * state.X + 123456789;
+    state.Y ^= state.Y << 21;
+    state.Y ^= state.Y >> 17;
+    state.Y ^= state.Y << 30;
+    t = 4294584393ULL * state.Z1 + state.C1;
+    state.C1 = t >> 32;
+    state.Z1 = t;
+    t = 4246477509ULL * state.Z2 + state.C2;
+    state.C2 = t >> 32;
+    state.Z2 = t;
+    return state.X + state.Y + state.Z1 + (static_cast<unsigned long long>(state.Z2) << 32);
 }
 
 template <>
-unsigned long long BasicRandGenerator<JKISS>::Variate()
+unsigned long long BasicRandGenerator<JKISS>::Step()
 {
-    static unsigned int X = 123456789 ^ time(0);
-    static unsigned int C = 6543217;
-    static unsigned int Y = 987654321;
-    static unsigned int Z = 43219876;
-    unsigned long long t = 698769069ULL * Z + C;
+    unsigned long long t = 698769069ULL * state.Z + state.C;
+
+    state.X *= 69069;
+    state.X += 12345;
 
-    X *= 69069;
-    X += 12345;
+    state.Y ^= state.Y << 13;
+    state.Y ^= state.Y >> 17;
+    state.Y ^= state.Y << 5;
 
-    Y ^= Y << 13;
-    Y ^= Y >> 17;
-    Y ^= Y << 5;
+    state.C = t >> 32;
+    state.Z = t;
 
-    C = t >> 32;
-    Z = t;
+    return state.X + state.Y + state.Z;
+}
 
-    return X + Y + Z;
+template <>
+unsigned long long BasicRandGenerator<PHILOX4x32>::Step()
+{
+    if (state.index == 2) {
+        PhiloxLanes<1>::Generate(state.key, state.counter, state.block);
+        addToCounter(state.counter, 1);
+        state.index = 0;
+    }
+    return state.block[state.index++];
+}
+
+template <>
+unsigned long long BasicRandGenerator<XOSHIRO256PP>::Step()
+{
+    unsigned long long sum = state.s[0] + state.s[3];
+    unsigned long long result = ((sum << 23) | (sum >> 41)) + state.s[0];
+    xoshiroStep(state.s);
+    return result;
+}
+
+template <>
+unsigned long long BasicRandGenerator<PCG64DXSM>::Step()
+{
+    /// output function is applied to the state before iteration
+    unsigned long long high = state.state[1];
+    unsigned long long low = state.state[0] | 1;
+    high ^= high >> 32;
+    high *= PCG_CHEAP_MULTIPLIER;
+    high ^= high >> 48;
+    high *= low;
+    /// LCG step: state = state * multiplier + increment
+    unsigned long long newLow = state.state[0] * PCG_CHEAP_MULTIPLIER;
+    unsigned long long newHigh = state.state[1] * PCG_CHEAP_MULTIPLIER + mulHigh(state.state[0], PCG_CHEAP_MULTIPLIER);
+    state.state[0] = newLow + state.increment[0];
+    state.state[1] = newHigh + state.increment[1] + (state.state[0] < newLow);
+    return high;
+}
+
+template <>
+void BasicRandGenerator<XOSHIRO256PP>::JumpState(unsigned long long n)
+{
+    XoshiroJump jump(n);
+    jump(state.s);
+}
+
+template <>
+void BasicRandGenerator<PCG64DXSM>::JumpState(unsigned long long n)
+{
+    UInt128 x(state.state[0], state.state[1]);
+    LCGJump<UInt128> jump(PCG_CHEAP_MULTIPLIER, UInt128(state.increment[0], state.increment[1]), n);
+    jump(x);
+    state.state[0] = x.low;
+    state.state[1] = x.high;
+}
+
+template <>
+void BasicRandGenerator<PHILOX4x32>::JumpState(unsigned long long n)
+{
+    /// output is a function of position, hence jump is an addition to counter
+    unsigned long long word = n & 1;
+    if (state.index != 2) {
+        /// move counter back to the current block
+        if (state.counter[0]-- == 0)
+            --state.counter[1];
+        word += state.index;
+    }
+    addToCounter(state.counter, (n >> 1) + (word >> 1));
+    state.index = 2;
+    if (word & 1) {
+        Step();
+    }
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::JumpState(unsigned long long n)
+{
+    KISSJump<Generator> jump(n);
+    jump(state);
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::LongJumpState()
+{
+    static constexpr unsigned long long HALF_JUMP = 1ULL << 63;
+    JumpState(HALF_JUMP);
+    JumpState(HALF_JUMP);
+    /// in KISS engines 2^64 steps are identity for linear congruential part with period 2^32 or 2^64
+    /// and one step for xorshift part with period 2^32 - 1 or 2^64 - 1. Hence the jump is longer by odd δ ~ 2^k / φ,
+    /// such that δ + 1 is coprime with 2^k - 1: every long jump moves both parts far
+    /// and they don't return to the same position before 2^k - 1 long jumps
+    if (Generator == JKISS)
+        JumpState(2654435773ULL);
+    else if (Generator == JLKISS64)
+        JumpState(11400714819323198485ULL);
+}
+
+template <>
+void BasicRandGenerator<XOSHIRO256PP>::LongJumpState()
+{
+    /// jump polynomial for 2^128 steps, given by authors of xoshiro
+    static constexpr unsigned long long JUMP[] = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+                                                   0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+    unsigned long long s[4] = {0};
+    for (unsigned long long word : JUMP) {
+        for (size_t b = 0; b != 64; ++b) {
+            if (word & (1ULL << b)) {
+                for (size_t i = 0; i != 4; ++i)
+                    s[i] ^= state.s[i];
+            }
+            xoshiroStep(state.s);
+        }
+    }
+    std::copy(s, s + 4, state.s);
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::FillState(unsigned long long *output, size_t size)
+{
+    typedef KISSLanes<Generator> Lanes;
+    static constexpr size_t ROUND = Lanes::LANES * Lanes::BLOCK;
+    if (size >= ROUND) {
+        /// every lane starts where the previous one ends
+        static const KISSJump<Generator> blockJump(Lanes::BLOCK);
+        Lanes lanes;
+        for (; size >= ROUND; size -= ROUND, output += ROUND) {
+            for (size_t k = 0; k != Lanes::LANES; ++k) {
+                lanes.Load(k, state);
+                blockJump(state);
+            }
+            lanes.Generate(output);
+        }
+    }
+    for (size_t i = 0; i != size; ++i)
+        output[i] = Step();
+}
+
+template <>
+void BasicRandGenerator<PHILOX4x32>::FillState(unsigned long long *output, size_t size)
+{
+    /// amount of 32-bit lanes in 256-bit register
+    static constexpr size_t LANES = 8;
+    static constexpr size_t ROUND = 2 * LANES;
+    /// take the rest of the current block
+    for (; size != 0 && state.index != 2; --size)
+        *output++ = Step();
+    for (; size >= ROUND; size -= ROUND, output += ROUND) {
+        PhiloxLanes<LANES>::Generate(state.key, state.counter, output);
+        addToCounter(state.counter, LANES);
+    }
+    for (size_t i = 0; i != size; ++i)
+        output[i] = Step();
+}
+
+template <>
+void BasicRandGenerator<XOSHIRO256PP>::FillState(unsigned long long *output, size_t size)
+{
+    for (size_t i = 0; i != size; ++i)
+        output[i] = Step();
+}
+
+template <>
+void BasicRandGenerator<PCG64DXSM>::FillState(unsigned long long *output, size_t size)
+{
+    for (size_t i = 0; i != size; ++i)
+        output[i] = Step();
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Seed(unsigned long long seed)
+{
+    SeedState(seed);
+    bits = 0;
+    bitsLeft = 0;
+    bufferIndex = buffer.size();
+}
+
+template < char Generator >
+unsigned long long BasicRandGenerator<Generator>::Next()
+{
+    /// numbers, generated in advance, go first
+    return (bufferIndex != buffer.size()) ? buffer[bufferIndex++] : Step();
+}
+
+template < char Generator >
+unsigned long long BasicRandGenerator<Generator>::NextBuffered()
+{
+    if (bufferIndex == buffer.size())
+        Refill();
+    return buffer[bufferIndex++];
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Fill(unsigned long long *output, size_t size)
+{
+    size_t buffered = std::min(size, buffer.size() - bufferIndex);
+    std::copy(buffer.data() + bufferIndex, buffer.data() + bufferIndex + buffered, output);
+    bufferIndex += buffered;
+    FillState(output + buffered, size - buffered);
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Jump(unsigned long long n)
+{
+    size_t buffered = buffer.size() - bufferIndex;
+    if (n <= buffered) {
+        bufferIndex += n;
+    }
+    else {
+        bufferIndex = buffer.size();
+        JumpState(n - buffered);
+    }
+    bitsLeft = 0;
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::LongJump()
+{
+    Rewind();
+    LongJumpState();
+    bitsLeft = 0;
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Refill()
+{
+    buffer.resize(BUFFER_SIZE);
+    bufferState = state;
+    FillState(buffer.data(), BUFFER_SIZE);
+    bufferIndex = 0;
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Rewind()
+{
+    if (bufferIndex != buffer.size()) {
+        state = bufferState;
+        JumpState(bufferIndex);
+        bufferIndex = buffer.size();
+    }
+}
+
+template < char Generator >
+int BasicRandGenerator<Generator>::NextBit()
+{
+    if (bitsLeft == 0)
+    {
+        /// refresh
+        bitsLeft = maxDecimals();
+        bits = Next();
+    }
+    --bitsLeft;
+    int bit = bits & 1;
+    bits >>= 1;
+    return bit;
+}
+
+/**
+ * @fn forEachField
+ * apply given function to every field of state in fixed order
+ * @param state
+ * @param f
+ */
+template < class Function >
+static void forEachField(RandState<JKISS> &state, Function f)
+{
+    f(state.X);
+    f(state.Y);
+    f(state.Z);
+    f(state.C);
+}
+
+template < class Function >
+static void forEachField(RandState<JLKISS64> &state, Function f)
+{
+    f(state.X);
+    f(state.Y);
+    f(state.Z1);
+    f(state.Z2);
+    f(state.C1);
+    f(state.C2);
+}
+
+template < class Function >
+static void forEachField(RandState<PHILOX4x32> &state, Function f)
+{
+    for (unsigned int & var : state.key)
+        f(var);
+    for (unsigned long long & var : state.counter)
+        f(var);
+    for (unsigned long long & var : state.block)
+        f(var);
+    f(state.index);
+}
+
+template < class Function >
+static void forEachField(RandState<XOSHIRO256PP> &state, Function f)
+{
+    for (unsigned long long & var : state.s)
+        f(var);
+}
+
+template < class Function >
+static void forEachField(RandState<PCG64DXSM> &state, Function f)
+{
+    for (unsigned long long & var : state.state)
+        f(var);
+    for (unsigned long long & var : state.increment)
+        f(var);
+}
+
+/**
+ * @fn isValidState
+ * @param state
+ * @return false if state can't be reached by the generator
+ */
+template < char Generator >
+static bool isValidState(const RandState<Generator> &)
+{
+    return true;
+}
+
+template <>
+bool isValidState<PHILOX4x32>(const RandState<PHILOX4x32> &state)
+{
+    return state.index <= 2;
+}
+
+template <>
+bool isValidState<XOSHIRO256PP>(const RandState<XOSHIRO256PP> &state)
+{
+    return (state.s[0] | state.s[1] | state.s[2] | state.s[3]) != 0;
+}
+
+/// version of binary format of saved state
+static constexpr unsigned char STATE_FORMAT_VERSION = 2;
+
+/**
+ * @fn writeWord
+ * write integer of any width into stream in little-endian order,
+ * so that saved state doesn't depend on platform
+ * @param out
+ * @param value
+ */
+template < typename UIntType >
+static void writeWord(std::ostream &out, UIntType value)
+{
+    char bytes[sizeof(UIntType)];
+    for (size_t i = 0; i != sizeof(UIntType); ++i)
+        bytes[i] = static_cast<char>((static_cast<unsigned long long>(value) >> (8 * i)) & 0xFF);
+    out.write(bytes, sizeof(UIntType));
+}
+
+template < typename UIntType >
+static void readWord(std::istream &in, UIntType &value)
+{
+    char bytes[sizeof(UIntType)] = {};
+    in.read(bytes, sizeof(UIntType));
+    unsigned long long word = 0;
+    for (size_t i = 0; i != sizeof(UIntType); ++i)
+        word |= static_cast<unsigned long long>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    value = static_cast<UIntType>(word);
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Save(std::ostream &out) const
+{
+    /// buffered numbers are not saved, they are regenerated from the state before refill
+    bool isBuffered = (bufferIndex != buffer.size());
+    RandState<Generator> stateCopy = isBuffered ? bufferState : state;
+    unsigned int bufferedTaken = isBuffered ? bufferIndex : 0;
+    out.put(Generator);
+    out.put(STATE_FORMAT_VERSION);
+    forEachField(stateCopy, [&out] (auto &field) { writeWord(out, field); });
+    writeWord(out, bits);
+    out.put(static_cast<char>(bitsLeft));
+    writeWord(out, bufferedTaken);
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Load(std::istream &in)
+{
+    char header[2] = {};
+    if (!in.read(header, 2))
+        throw std::invalid_argument("BasicRandGenerator: unable to read saved state");
+    if (header[0] != Generator)
+        throw std::invalid_argument("BasicRandGenerator: saved state belongs to generator of another type");
+    if (header[1] != 1 && header[1] != STATE_FORMAT_VERSION)
+        throw std::invalid_argument("BasicRandGenerator: unknown version of saved state");
+    RandState<Generator> newState = state;
+    forEachField(newState, [&in] (auto &field) { readWord(in, field); });
+    unsigned long long newBits = 0;
+    readWord(in, newBits);
+    int newBitsLeft = in.get();
+    /// the first version has no buffer
+    unsigned int bufferedTaken = 0;
+    if (header[1] != 1)
+        readWord(in, bufferedTaken);
+    if (!in || !isValidState<Generator>(newState) || newBitsLeft < 0 || static_cast<size_t>(newBitsLeft) > maxDecimals() || bufferedTaken >= BUFFER_SIZE)
+        throw std::invalid_argument("BasicRandGenerator: saved state is corrupted");
+    /// change nothing until the whole state is read successfully
+    state = newState;
+    bits = newBits;
+    bitsLeft = newBitsLeft;
+    bufferIndex = buffer.size();
+    if (bufferedTaken != 0) {
+        Refill();
+        bufferIndex = bufferedTaken;
+    }
+}
+
+template < char Generator >
+unsigned long long BasicRandGenerator<Generator>::Variate()
+{
+    return localEngine.NextBuffered();
+}
+
+template < char Generator >
+int BasicRandGenerator<Generator>::BitVariate()
+{
+    return localEngine.NextBit();
+}
+
+template < char Generator >
+BasicRandGenerator<Generator> &BasicRandGenerator<Generator>::Local()
+{
+    return localEngine;
+}
+
+template < char Generator >
+void BasicRandGenerator<Generator>::Swap(BasicRandGenerator &engine)
+{
+    std::swap(localEngine.state, engine.state);
+    std::swap(localEngine.bits, engine.bits);
+    std::swap(localEngine.bitsLeft, engine.bitsLeft);
+    std::swap(localEngine.buffer, engine.buffer);
+    std::swap(localEngine.bufferIndex, engine.bufferIndex);
+    std::swap(localEngine.bufferState, engine.bufferState);
 }
 
 template < char Generator >
@@ -62,3 +1058,6 @@ size_t BasicRandGenerator<Generator>::maxDecimals()
 
 template class BasicRandGenerator<JLKISS64>;
 template class BasicRandGenerator<JKISS>;
+template class BasicRandGenerator<PHILOX4x32>;
+template class BasicRandGenerator<XOSHIRO256PP>;
+template class BasicRandGenerator<PCG64DXSM>;
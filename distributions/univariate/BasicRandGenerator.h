@@ -3,38 +3,271 @@
 
 #include "RandLib_global.h"
 #include <time.h>
+#include <stddef.h>
+#include <iosfwd>
+#include <vector>
 
 enum GeneratorType {
     JKISS, ///< period is 2^1271
-    JLKISS64 ///< period is 2^250
+    JLKISS64, ///< period is 2^250
+    PHILOX4x32, ///< counter-based, period is 2^129
+    XOSHIRO256PP, ///< xoshiro256++, period is 2^256 - 1
+    PCG64DXSM ///< permuted 128-bit LCG with DXSM output, period is 2^128
 };
 
+/**
+ * @brief The RandState struct
+ * Inner state of generator of given type
+ */
+template < char Generator >
+struct RandState;
+
+template <>
+struct RandState<JKISS>
+{
+    unsigned int X; ///< linear congruential generator
+    unsigned int Y; ///< xorshift generator
+    unsigned int Z; ///< multiply-with-carry generator
+    unsigned int C; ///< carry of multiply-with-carry generator
+};
+
+template <>
+struct RandState<JLKISS64>
+{
+    unsigned long long X; ///< linear congruential generator
+    unsigned long long Y; ///< xorshift generator
+    unsigned int Z1, Z2; ///< multiply-with-carry generators
+    unsigned int C1, C2; ///< carries of multiply-with-carry generators
+};
+
+template <>
+struct RandState<PHILOX4x32>
+{
+    unsigned int key[2]; ///< key of bijection
+    unsigned long long counter[2]; ///< 128-bit counter of the next block, low word goes first
+    unsigned long long block[2]; ///< last generated block
+    unsigned int index; ///< amount of taken words of the last block
+};
+
+template <>
+struct RandState<XOSHIRO256PP>
+{
+    unsigned long long s[4]; ///< state of linear generator, shouldn't be all zeros
+};
+
+template <>
+struct RandState<PCG64DXSM>
+{
+    unsigned long long state[2]; ///< 128-bit state of LCG, low word goes first
+    unsigned long long increment[2]; ///< 128-bit odd increment of LCG, low word goes first
+};
 
 /**
  * @brief The BasicRandGenerator class
- * Class for generators of random number, spreaded uniformly
+ * Class for generators of random number, spreaded uniformly.
+ * Every object is an independent engine with its own state.
+ * Static methods draw from the engine owned by the calling thread,
+ * so that different threads never share any state.
  */
 template < char Generator >
 class RANDLIBSHARED_EXPORT BasicRandGenerator
 {
+    RandState<Generator> state;
+    unsigned long long bits = 0; ///< buffered random bits
+    size_t bitsLeft = 0; ///< amount of bits left in buffer
+    std::vector<unsigned long long> buffer; ///< numbers, generated in advance by bulk filling
+    size_t bufferIndex = 0; ///< amount of taken numbers in buffer
+    RandState<Generator> bufferState; ///< state before the last refill of buffer
+
+    static constexpr size_t BUFFER_SIZE = 4096; ///< amount of numbers in refilled buffer
+
+    static thread_local BasicRandGenerator localEngine;
 
 public:
-    BasicRandGenerator() {}
+    /**
+     * @brief BasicRandGenerator
+     * create engine with unique seed, based on time and amount of previously created engines
+     */
+    BasicRandGenerator();
+    explicit BasicRandGenerator(unsigned long long seed);
+
+    /**
+     * @fn Seed
+     * reset state, deterministically derived from given seed
+     * @param seed
+     */
+    void Seed(unsigned long long seed);
 
+    /**
+     * @fn Next
+     * @return next random number of this engine
+     */
+    unsigned long long Next();
+
+    /**
+     * @fn NextBuffered
+     * @return next random number of this engine, taken from inner buffer,
+     * which is refilled by Fill() in blocks of BUFFER_SIZE numbers.
+     * The sequence is the same as of Next(), it is only generated in advance
+     */
+    unsigned long long NextBuffered();
+
+    /**
+     * @fn Fill
+     * fill array with next random numbers of this engine,
+     * the result is the same as after consecutive calls of Next().
+     * Long arrays are split into blocks, generated simultaneously by independent lanes
+     * @param output
+     * @param size
+     */
+    void Fill(unsigned long long *output, size_t size);
+
+    /**
+     * @fn NextBit
+     * @return next random bit of this engine
+     */
+    int NextBit();
+
+    /**
+     * @fn Jump
+     * advance state by n steps in O(log(n)) time,
+     * as if Next() was called n times
+     * @param n
+     */
+    void Jump(unsigned long long n);
+
+    /**
+     * @fn LongJump
+     * advance state by 2^64 steps (2^128 for xoshiro256++, 2^64 + 2654435773 for JKISS
+     * and 2^64 + 11400714819323198485 for JLKISS64, so that every part of KISS engine is moved far),
+     * hence engines, separated by long jumps, never overlap in practice
+     */
+    void LongJump();
+
+    /**
+     * @fn Save
+     * write the whole state of engine (including buffered bits) into binary stream,
+     * so that the sequence can be resumed later by Load()
+     * @param out
+     */
+    void Save(std::ostream &out) const;
+
+    /**
+     * @fn Load
+     * restore state, previously written by Save() of engine of the same type
+     * @param in
+     */
+    void Load(std::istream &in);
+
+    /**
+     * @fn Variate
+     * @return next random number of the engine of current thread, taken from its buffer
+     */
     static unsigned long long Variate();
 
+    /**
+     * @fn BitVariate
+     * @return next random bit of the engine of current thread
+     */
+    static int BitVariate();
+
+    /**
+     * @fn Local
+     * @return engine of current thread
+     */
+    static BasicRandGenerator &Local();
+
+    /**
+     * @brief The Scope class
+     * During the lifetime of the object given engine replaces the engine of current thread,
+     * hence all the variates generated in between are drawn from it
+     */
+    class Scope
+    {
+        BasicRandGenerator &engine;
+    public:
+        explicit Scope(BasicRandGenerator &boundEngine) : engine(boundEngine) { Swap(engine); }
+        ~Scope() { Swap(engine); }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
     static constexpr unsigned long long MinValue() {
         return 0;
     }
 
     static constexpr unsigned long long MaxValue() {
-        return (Generator == JLKISS64) ? 18446744073709551615ULL : 4294967295UL;
+        return (Generator == JKISS) ? 4294967295UL : 18446744073709551615ULL;
     }
     static size_t maxDecimals();
+
+private:
+    /**
+     * @fn SeedState
+     * reset state of generator, ignoring buffers
+     * @param seed
+     */
+    void SeedState(unsigned long long seed);
+
+    /**
+     * @fn Step
+     * @return next random number, generated directly from the state
+     */
+    unsigned long long Step();
+
+    /**
+     * @fn FillState
+     * fill array with numbers, generated directly from the state
+     * @param output
+     * @param size
+     */
+    void FillState(unsigned long long *output, size_t size);
+
+    /**
+     * @fn JumpState
+     * advance the state by n steps, ignoring buffers
+     * @param n
+     */
+    void JumpState(unsigned long long n);
+
+    /**
+     * @fn LongJumpState
+     * advance the state by the long jump, ignoring buffers
+     */
+    void LongJumpState();
+
+    /**
+     * @fn Refill
+     * generate the whole buffer anew
+     */
+    void Refill();
+
+    /**
+     * @fn Rewind
+     * drop the rest of buffer and move the state back to the first untaken number
+     */
+    void Rewind();
+
+    /**
+     * @fn Swap
+     * exchange states of given engine and the engine of current thread
+     * @param engine
+     */
+    static void Swap(BasicRandGenerator &engine);
 };
 
+#if defined(JLKISS64RAND) || defined(PHILOX4x32RAND) || defined(XOSHIRO256PPRAND) || defined(PCG64DXSMRAND)
+#define RANDGENERATOR64 ///< generator returns 64-bit numbers
+#endif
+
 #ifdef JLKISS64RAND
 typedef BasicRandGenerator<JLKISS64> RandGenerator;
+#elif defined(PHILOX4x32RAND)
+typedef BasicRandGenerator<PHILOX4x32> RandGenerator;
+#elif defined(XOSHIRO256PPRAND)
+typedef BasicRandGenerator<XOSHIRO256PP> RandGenerator;
+#elif defined(PCG64DXSMRAND)
+typedef BasicRandGenerator<PCG64DXSM> RandGenerator;
 #else
 typedef BasicRandGenerator<JKISS> RandGenerator;
 #endif
@@ -0,0 +1,255 @@
+#include "QuasiRandGenerator.h"
+#include "BasicRandGenerator.h"
+#include "continuous/UniformRand.h"
+#include <numeric>
+
+QuasiRandGenerator::QuasiRandGenerator(size_t dimensionValue)
+    : dimension(dimensionValue)
+{
+}
+
+/**
+ * @brief The SobolDirections struct
+ * degree s and coefficients a of primitive polynomial and initial direction numbers m_1, ..., m_s
+ * (new-joe-kuo-6.21201), the first coordinate is van der Corput sequence
+ */
+struct SobolDirections
+{
+    int s;
+    int a;
+    unsigned int m[7];
+};
+
+static constexpr SobolDirections SOBOL_DIRECTIONS[SobolRandGenerator::MAX_DIMENSION - 1] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}}
+};
+
+/**
+ * @fn reverseBits
+ * @param x
+ * @return x with bits in reversed order
+ */
+static unsigned int reverseBits(unsigned int x)
+{
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+SobolRandGenerator::SobolRandGenerator(size_t dimensionValue, SCRAMBLING scramblingType)
+    : QuasiRandGenerator(dimensionValue), scrambling(scramblingType)
+{
+    if (dimension == 0 || dimension > MAX_DIMENSION)
+        throw std::invalid_argument("Sobol sequence: dimension should be positive and not greater than " + std::to_string(MAX_DIMENSION));
+    directions.resize(32 * dimension);
+    for (int k = 0; k != 32; ++k)
+        directions[k] = 1u << (31 - k);
+    for (size_t j = 1; j != dimension; ++j) {
+        const SobolDirections &init = SOBOL_DIRECTIONS[j - 1];
+        unsigned int *v = directions.data() + 32 * j;
+        for (int k = 0; k != init.s; ++k)
+            v[k] = init.m[k] << (31 - k);
+        for (int k = init.s; k != 32; ++k) {
+            v[k] = v[k - init.s] ^ (v[k - init.s] >> init.s);
+            for (int l = 1; l != init.s; ++l) {
+                if ((init.a >> (init.s - 1 - l)) & 1)
+                    v[k] ^= v[k - l];
+            }
+        }
+    }
+    Rescramble();
+}
+
+void SobolRandGenerator::Rescramble()
+{
+    seeds.resize(dimension);
+    for (unsigned int & seed : seeds)
+        seed = (scrambling == NONE) ? 0 : static_cast<unsigned int>(RandGenerator::Variate());
+    Reset();
+}
+
+void SobolRandGenerator::Reset()
+{
+    state.assign(dimension, 0);
+    index = 0;
+}
+
+unsigned int SobolRandGenerator::scramble(unsigned int x, unsigned int seed) const
+{
+    if (scrambling == DIGITAL_SHIFT)
+        return x ^ seed;
+    if (scrambling == OWEN) {
+        /// Laine-Karras permutation changes each bit depending only on lower bits,
+        /// hence after reversal each digit is permuted depending only on the previous ones
+        x = reverseBits(x) + seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return reverseBits(x);
+    }
+    return x;
+}
+
+void SobolRandGenerator::Fill(double *output, size_t size)
+{
+    /// points are shifted to the centers of cells of size 2^(-32), so that they never hit the corner
+    static constexpr double SCALE = 1.0 / 4294967296.0;
+    for (size_t i = 0; i != size; ++i) {
+        for (size_t j = 0; j != dimension; ++j)
+            output[i * dimension + j] = (scramble(state[j], seeds[j]) + 0.5) * SCALE;
+        /// Gray code order: the next point differs by the direction number of the lowest zero bit of index
+        ++index;
+        int bit = 0;
+        while (((index >> bit) & 1) == 0)
+            ++bit;
+        if (bit >= 32) {
+            Reset();
+            continue;
+        }
+        for (size_t j = 0; j != dimension; ++j)
+            state[j] ^= directions[32 * j + bit];
+    }
+}
+
+/**
+ * @brief HALTON_BASES
+ * the first prime numbers
+ */
+static constexpr unsigned int HALTON_BASES[HaltonRandGenerator::MAX_DIMENSION] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
+    59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127, 131
+};
+
+HaltonRandGenerator::HaltonRandGenerator(size_t dimensionValue)
+    : QuasiRandGenerator(dimensionValue)
+{
+    if (dimension == 0 || dimension > MAX_DIMENSION)
+        throw std::invalid_argument("Halton sequence: dimension should be positive and not greater than " + std::to_string(MAX_DIMENSION));
+}
+
+void HaltonRandGenerator::Reset()
+{
+    index = 1;
+}
+
+void HaltonRandGenerator::Fill(double *output, size_t size)
+{
+    for (size_t i = 0; i != size; ++i, ++index) {
+        for (size_t j = 0; j != dimension; ++j) {
+            /// radical inverse: digits of index are mirrored around the radix point
+            unsigned int base = HALTON_BASES[j];
+            double baseInv = 1.0 / base, digitValue = baseInv, radicalInverse = 0.0;
+            for (unsigned long long n = index; n > 0; n /= base) {
+                radicalInverse += (n % base) * digitValue;
+                digitValue *= baseInv;
+            }
+            output[i * dimension + j] = radicalInverse;
+        }
+    }
+}
+
+LatticeRandGenerator::LatticeRandGenerator(unsigned long long size, size_t dimensionValue, bool isRandomlyShifted, bool isTentTransformedValue)
+    : QuasiRandGenerator(dimensionValue), isTentTransformed(isTentTransformedValue)
+{
+    if (dimension == 0)
+        throw std::invalid_argument("Rank-1 lattice: dimension should be positive");
+    if (size == 0)
+        throw std::invalid_argument("Rank-1 lattice: amount of points should be positive");
+    /// generalized golden ratio φ is the positive root of x^(d + 1) = x + 1,
+    /// Kronecker sequence {n / φ^j} has low discrepancy, and lattice approximates it
+    double phi = 2.0;
+    for (int iter = 0; iter != 64; ++iter)
+        phi = std::pow(1.0 + phi, 1.0 / (dimension + 1));
+    std::vector<unsigned long long> z(dimension);
+    double alpha = 1.0;
+    for (size_t j = 0; j != dimension; ++j) {
+        alpha /= phi;
+        unsigned long long zj = static_cast<unsigned long long>(std::llround(alpha * size)) % size;
+        /// components should be coprime with N, so that each projection contains all N points
+        while (std::gcd(zj, size) != 1)
+            zj = (zj + 1) % size;
+        z[j] = zj;
+    }
+    setGeneratingVector(size, z, isRandomlyShifted);
+}
+
+LatticeRandGenerator::LatticeRandGenerator(unsigned long long size, const std::vector<unsigned long long> &generatingVectorValue,
+                                           bool isRandomlyShifted, bool isTentTransformedValue)
+    : QuasiRandGenerator(generatingVectorValue.size()), isTentTransformed(isTentTransformedValue)
+{
+    if (dimension == 0)
+        throw std::invalid_argument("Rank-1 lattice: dimension should be positive");
+    if (size == 0)
+        throw std::invalid_argument("Rank-1 lattice: amount of points should be positive");
+    setGeneratingVector(size, generatingVectorValue, isRandomlyShifted);
+}
+
+void LatticeRandGenerator::setGeneratingVector(unsigned long long size, const std::vector<unsigned long long> &generatingVectorValue, bool isRandomlyShifted)
+{
+    pointsNum = size;
+    generatingVector.resize(dimension);
+    for (size_t j = 0; j != dimension; ++j)
+        generatingVector[j] = generatingVectorValue[j] % pointsNum;
+    if (isRandomlyShifted)
+        Reshift();
+    else {
+        /// shift 1 / (4N) keeps points off the corner and off the middle, which tent transformation maps to 1
+        shift.assign(dimension, (isTentTransformed ? 0.25 : 0.5) / pointsNum);
+        Reset();
+    }
+}
+
+void LatticeRandGenerator::Reshift()
+{
+    shift.resize(dimension);
+    for (double & var : shift)
+        var = UniformRand::StandardVariate();
+    Reset();
+}
+
+void LatticeRandGenerator::Reset()
+{
+    state.assign(dimension, 0);
+    index = 0;
+}
+
+void LatticeRandGenerator::Fill(double *output, size_t size)
+{
+    double pointsNumInv = 1.0 / pointsNum;
+    for (size_t i = 0; i != size; ++i) {
+        for (size_t j = 0; j != dimension; ++j) {
+            double x = state[j] * pointsNumInv + shift[j];
+            if (x >= 1.0)
+                x -= 1.0;
+            output[i * dimension + j] = isTentTransformed ? 1.0 - std::fabs(2.0 * x - 1.0) : x;
+            /// n * z mod N is updated by addition
+            state[j] += generatingVector[j];
+            if (state[j] >= pointsNum)
+                state[j] -= pointsNum;
+        }
+        if (++index == pointsNum)
+            Reset();
+    }
+}
@@ -0,0 +1,175 @@
+#ifndef QUASIRANDGENERATOR_H
+#define QUASIRANDGENERATOR_H
+
+#include <vector>
+#include <cstddef>
+#include "RandLib_global.h"
+
+/**
+ * @brief The QuasiRandGenerator class <BR>
+ * Abstract class for generators of low-discrepancy (quasi-random) sequences in unit cube [0, 1)^d.
+ * Error of integration by n such points decreases as O(log(n)^d / n)
+ * instead of O(1 / sqrt(n)) for pseudo-random points
+ */
+class RANDLIBSHARED_EXPORT QuasiRandGenerator
+{
+protected:
+    size_t dimension = 1; ///< dimension of points
+
+    explicit QuasiRandGenerator(size_t dimensionValue);
+
+public:
+    virtual ~QuasiRandGenerator() {}
+
+    /**
+     * @fn Dimension
+     * @return dimension of points
+     */
+    inline size_t Dimension() const { return dimension; }
+
+    /**
+     * @fn Fill
+     * fill array with coordinates of next points, one point after another
+     * @param output array of size * Dimension() numbers in (0, 1)
+     * @param size amount of points
+     */
+    virtual void Fill(double *output, size_t size) = 0;
+
+    /**
+     * @fn Reset
+     * restart sequence from the first point, randomization stays the same
+     */
+    virtual void Reset() = 0;
+};
+
+/**
+ * @brief The SobolRandGenerator class <BR>
+ * Sobol sequence with direction numbers of Joe and Kuo, generated in Gray code order.
+ * Randomization by digital shift or by nested uniform (Owen) scrambling keeps points low-discrepant
+ * and makes estimates unbiased. Owen scrambling is hash-based of Laine, Karras and Burley
+ */
+class RANDLIBSHARED_EXPORT SobolRandGenerator : public QuasiRandGenerator
+{
+public:
+    enum SCRAMBLING {
+        NONE,
+        DIGITAL_SHIFT,
+        OWEN
+    };
+
+    static constexpr size_t MAX_DIMENSION = 21;
+
+private:
+    SCRAMBLING scrambling = NONE;
+    std::vector<unsigned int> directions{}; ///< 32 direction numbers for each coordinate
+    std::vector<unsigned int> seeds{}; ///< random seeds of scrambling for each coordinate
+    std::vector<unsigned int> state{}; ///< current point before scrambling
+    unsigned long long index = 0; ///< index of current point
+
+public:
+    /**
+     * @fn SobolRandGenerator
+     * @param dimensionValue from 1 to MAX_DIMENSION
+     * @param scramblingType
+     */
+    explicit SobolRandGenerator(size_t dimensionValue = 1, SCRAMBLING scramblingType = NONE);
+
+    inline SCRAMBLING GetScrambling() const { return scrambling; }
+
+    void Fill(double *output, size_t size) override;
+    void Reset() override;
+
+    /**
+     * @fn Rescramble
+     * draw new seeds of scrambling and restart sequence
+     */
+    void Rescramble();
+
+private:
+    /**
+     * @fn scramble
+     * @param x
+     * @param seed
+     * @return x after scrambling of chosen type
+     */
+    unsigned int scramble(unsigned int x, unsigned int seed) const;
+};
+
+/**
+ * @brief The HaltonRandGenerator class <BR>
+ * Halton sequence: coordinate j of point n is radical inverse of n in base of j-th prime number.
+ * Point 0, which is at the corner of cube, is skipped
+ */
+class RANDLIBSHARED_EXPORT HaltonRandGenerator : public QuasiRandGenerator
+{
+public:
+    static constexpr size_t MAX_DIMENSION = 32;
+
+private:
+    unsigned long long index = 1; ///< index of current point
+
+public:
+    /**
+     * @fn HaltonRandGenerator
+     * @param dimensionValue from 1 to MAX_DIMENSION
+     */
+    explicit HaltonRandGenerator(size_t dimensionValue = 1);
+
+    void Fill(double *output, size_t size) override;
+    void Reset() override;
+};
+
+/**
+ * @brief The LatticeRandGenerator class <BR>
+ * Rank-1 lattice of N points: x_n = {n z / N + Δ}, where z is generating vector and Δ is shift.
+ * Default generating vector approximates Kronecker sequence of Roberts with generalized golden ratio,
+ * shift is either random (Cranley-Patterson rotation) or small, so that points avoid the corner of cube.
+ * Tent (baker's) transformation x -> 1 - |2x - 1| makes lattice efficient for non-periodic integrands.
+ * After N points sequence repeats itself
+ */
+class RANDLIBSHARED_EXPORT LatticeRandGenerator : public QuasiRandGenerator
+{
+    unsigned long long pointsNum = 1; ///< N
+    std::vector<unsigned long long> generatingVector{}; ///< z
+    std::vector<double> shift{}; ///< Δ
+    std::vector<unsigned long long> state{}; ///< n * z mod N
+    bool isTentTransformed = true;
+    unsigned long long index = 0; ///< index of current point
+
+public:
+    /**
+     * @fn LatticeRandGenerator
+     * @param size N, amount of points in lattice
+     * @param dimensionValue
+     * @param isRandomlyShifted
+     * @param isTentTransformedValue
+     */
+    LatticeRandGenerator(unsigned long long size, size_t dimensionValue = 1, bool isRandomlyShifted = false, bool isTentTransformedValue = true);
+
+    /**
+     * @fn LatticeRandGenerator
+     * @param size N, amount of points in lattice
+     * @param generatingVectorValue z, its length defines dimension
+     * @param isRandomlyShifted
+     * @param isTentTransformedValue
+     */
+    LatticeRandGenerator(unsigned long long size, const std::vector<unsigned long long> &generatingVectorValue,
+                         bool isRandomlyShifted = false, bool isTentTransformedValue = true);
+
+    inline unsigned long long GetPointsNum() const { return pointsNum; }
+    inline const std::vector<unsigned long long> &GetGeneratingVector() const { return generatingVector; }
+
+    void Fill(double *output, size_t size) override;
+    void Reset() override;
+
+    /**
+     * @fn Reshift
+     * draw new random shift and restart sequence
+     */
+    void Reshift();
+
+private:
+    void setGeneratingVector(unsigned long long size, const std::vector<unsigned long long> &generatingVectorValue, bool isRandomlyShifted);
+};
+
+#endif // QUASIRANDGENERATOR_H
@@ -1,4 +1,5 @@
 #include "UnivariateDistribution.h"
+#include "QuasiRandGenerator.h"
 
 template< typename T >
 UnivariateDistribution<T>::UnivariateDistribution()
@@ -61,6 +62,25 @@ void UnivariateDistribution<T>::QuantileFunction(const std::vector<double> &p, s
         y[i] = Quantile(p[i]);
 }
 
+template< typename T >
+void UnivariateDistribution<T>::Sample(QuasiRandGenerator &generator, std::vector<T> &outputData) const
+{
+    size_t dimension = generator.Dimension();
+    size_t size = outputData.size();
+    if (size % dimension != 0)
+        throw std::invalid_argument("Sample size should be divisible by dimension of quasi-random sequence");
+    /// points are generated chunk by chunk
+    static constexpr size_t CHUNK_SIZE = 4096;
+    size_t chunkPointsNum = std::max(CHUNK_SIZE / dimension, size_t(1));
+    std::vector<double> points(std::min(chunkPointsNum * dimension, size));
+    for (size_t begin = 0; begin < size; begin += chunkPointsNum * dimension) {
+        size_t chunkSize = std::min(chunkPointsNum * dimension, size - begin);
+        generator.Fill(points.data(), chunkSize / dimension);
+        for (size_t i = 0; i != chunkSize; ++i)
+            outputData[begin + i] = static_cast<T>(Quantile(points[i]));
+    }
+}
+
 template< typename T >
 std::complex<double> UnivariateDistribution<T>::CF(double t) const
 {
@@ -3,6 +3,8 @@
 
 #include "../ProbabilityDistribution.h"
 
+class QuasiRandGenerator;
+
 enum SUPPORT_TYPE {
     FINITE_T,
     RIGHTSEMIFINITE_T,
@@ -105,6 +107,16 @@ public:
      */
     void QuantileFunction(const std::vector<double> &p, std::vector<double> &y);
 
+    using ProbabilityDistribution<T>::Sample;
+    /**
+     * @fn Sample
+     * fill vector by inversion of quasi-random points: coordinates of consecutive points
+     * are pushed through quantile function, so that every point gives Dimension() variates
+     * @param generator low-discrepancy sequence
+     * @param outputData vector, which size is divisible by dimension of generator
+     */
+    void Sample(QuasiRandGenerator &generator, std::vector<T> &outputData) const;
+
     /**
      * @fn CF
      * @param t
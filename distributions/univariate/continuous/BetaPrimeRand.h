@@ -38,6 +38,8 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
 
     void Sample(std::vector<double> &outputData) const override;
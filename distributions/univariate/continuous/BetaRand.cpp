@@ -94,6 +94,25 @@ double BetaDistribution::f(const double & x) const
     return std::exp(logf(x));
 }
 
+void BetaDistribution::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    /// terms of logarithm of density grow with shapes and cancel each other,
+    /// hence it is evaluated in double precision and rounded once
+    double shape1m1 = alpha - 1.0, shape2m1 = beta - 1.0, coef = -logBetaFun - logBma;
+    for (size_t i = 0; i != size; ++i) {
+        double xD = x[i];
+        if (xD > a && xD < b) {
+            double xSt = (xD - a) * bmaInv;
+            y[i] = std::exp(shape1m1 * std::log(xSt) + shape2m1 * std::log1p(-xSt) + coef);
+        }
+        else
+            y[i] = f(xD);
+    }
+}
+
 double BetaDistribution::logf(const double & x) const
 {
     /// Standardize
@@ -300,6 +319,9 @@ double BetaDistribution::Variate() const
 void BetaDistribution::Sample(std::vector<double> &outputData) const
 {
     GENERATOR_ID id = getIdOfUsedGenerator();
+    /// rejection from hat is faster than any specialized generator, except for uniform one
+    if (id != UNIFORM && sampleByRejection(outputData))
+        return;
 
     switch (id) {
     case UNIFORM: {
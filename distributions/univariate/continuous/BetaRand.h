@@ -50,6 +50,7 @@ public:
     SUPPORT_TYPE SupportType() const override { return FINITE_T; }
     double MinValue() const override { return a; }
     double MaxValue() const override { return b; }
+    bool IsLogConcave() const override { return alpha >= 1 && beta >= 1; }
 
 private:
     enum GENERATOR_ID {
@@ -115,6 +116,10 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using ContinuousDistribution::ProbabilityDensityFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
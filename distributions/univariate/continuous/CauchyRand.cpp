@@ -26,6 +26,28 @@ double CauchyRand::S(const double & x) const
     return cdfCauchyCompl(x);
 }
 
+void CauchyRand::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = mu, scale = gamma, coef = M_1_PI / gamma;
+    for (size_t i = 0; i != size; ++i) {
+        float z = (x[i] - location) / scale;
+        y[i] = coef / (1.0f + z * z);
+    }
+}
+
+void CauchyRand::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = mu, scale = gamma, coef = M_1_PI;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = 0.5f + coef * std::atan((x[i] - location) / scale);
+}
+
 double CauchyRand::Variate() const
 {
     return mu + gamma * StandardVariate();
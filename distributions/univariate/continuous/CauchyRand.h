@@ -29,6 +29,11 @@ public:
     double f(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using StableDistribution::ProbabilityDensityFunction;
+    using StableDistribution::CumulativeDistributionFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    void CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    using StableDistribution::Variate;
     double Variate() const override;
 
     static double StandardVariate();
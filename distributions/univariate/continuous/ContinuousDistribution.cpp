@@ -1,5 +1,6 @@
 #include "ContinuousDistribution.h"
 #include "KolmogorovSmirnovRand.h"
+#include "TransformedDensityRejection.h"
 
 void ContinuousDistribution::ProbabilityDensityFunction(const std::vector<double> &x, std::vector<double> &y) const
 {
@@ -19,6 +20,66 @@ void ContinuousDistribution::LogProbabilityDensityFunction(const std::vector<dou
         y[i] = logf(x[i]);
 }
 
+void ContinuousDistribution::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = f(x[i]);
+}
+
+void ContinuousDistribution::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = F(x[i]);
+}
+
+bool ContinuousDistribution::sampleByRejection(std::vector<double> &outputData) const
+{
+    /// setup of hat pays off only for large samples
+    static constexpr size_t MIN_SIZE_FOR_REJECTION = 16384;
+    if (!IsLogConcave() || outputData.size() < MIN_SIZE_FOR_REJECTION)
+        return false;
+    try {
+        TransformedDensityRejection generator(*this);
+        generator.Sample(outputData);
+    }
+    catch (const std::invalid_argument &) {
+        /// hat can't be built due to numerical problems, e.g. density underflows at mode
+        return false;
+    }
+    return true;
+}
+
+void ContinuousDistribution::Sample(std::vector<double> &outputData) const
+{
+    if (!sampleByRejection(outputData))
+        UnivariateDistribution<double>::Sample(outputData);
+}
+
+void ContinuousDistribution::Sample(std::vector<float> &outputData) const
+{
+    /// variates are generated in double precision chunk by chunk and then rounded
+    static constexpr size_t CHUNK_SIZE = 4096;
+    size_t size = outputData.size();
+    std::vector<double> chunk(std::min(CHUNK_SIZE, size));
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        chunk.resize(std::min(CHUNK_SIZE, size - begin));
+        this->Sample(chunk);
+        std::copy(chunk.begin(), chunk.end(), outputData.begin() + begin);
+    }
+}
+
+void ContinuousDistribution::Sample(RandGenerator &engine, std::vector<float> &outputData) const
+{
+    RandGenerator::Scope scope(engine);
+    this->Sample(outputData);
+}
+
 double ContinuousDistribution::quantileImpl(double p) const
 {
     double guess = 0.0;
@@ -34,7 +95,7 @@ double ContinuousDistribution::quantileImpl(double p) const
 
     /// We use quantile from sample as an initial guess
     static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<double> sample(SAMPLE_SIZE);
+    static thread_local std::vector<double> sample(SAMPLE_SIZE);
     this->Sample(sample);
     int index = p * SAMPLE_SIZE;
     /// if p is too small
@@ -82,7 +143,7 @@ double ContinuousDistribution::quantileImpl1m(double p) const
 
     /// We use quantile from sample as an initial guess
     static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<double> sample(SAMPLE_SIZE);
+    static thread_local std::vector<double> sample(SAMPLE_SIZE);
     this->Sample(sample);
     int index = p * SAMPLE_SIZE;
     /// if p is too small
@@ -44,9 +44,66 @@ public:
      */
     void LogProbabilityDensityFunction(const std::vector<double> &x, std::vector<double> &y) const;
 
+    /**
+     * @fn ProbabilityDensityFunction
+     * fill vector y by f(x) in single precision
+     * @param x
+     * @param y
+     */
+    virtual void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const;
+
+    using UnivariateDistribution<double>::CumulativeDistributionFunction;
+    /**
+     * @fn CumulativeDistributionFunction
+     * fill vector y by F(x) in single precision
+     * @param x
+     * @param y
+     */
+    virtual void CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const;
+
+    /**
+     * @fn IsLogConcave
+     * @return true if logarithm of density is concave on support,
+     * so that large samples can be generated by transformed density rejection.
+     * Distributions with faster specialized generators don't need to report it
+     */
+    virtual bool IsLogConcave() const { return false; }
+
+    using UnivariateDistribution<double>::Sample;
+    /**
+     * @fn Sample
+     * fill vector by variates, using transformed density rejection
+     * if density is log-concave and sample is large enough
+     * @param outputData
+     */
+    void Sample(std::vector<double> &outputData) const override;
+
+    /**
+     * @fn Sample
+     * fill vector by variates in single precision
+     * @param outputData
+     */
+    virtual void Sample(std::vector<float> &outputData) const;
+
+    /**
+     * @fn Sample
+     * @param engine
+     * @param outputData variates in single precision, generated by given engine
+     */
+    void Sample(RandGenerator &engine, std::vector<float> &outputData) const;
+
     double Mode() const override;
 
 protected:
+    /**
+     * @fn sampleByRejection
+     * fill vector by transformed density rejection,
+     * if density is log-concave, sample is large enough and hat can be built
+     * @param outputData
+     * @return true if vector is filled
+     */
+    bool sampleByRejection(std::vector<double> &outputData) const;
+
     double quantileImpl(double p) const override;
     double quantileImpl1m(double p) const override;
     double ExpectedValue(const std::function<double (double)> &funPtr, double minPoint, double maxPoint) const override;
@@ -1,35 +1,16 @@
 #include "ExponentialRand.h"
 #include "UniformRand.h"
 #include "../BasicRandGenerator.h"
+#include "ZigguratTables.h"
 
-long double ExponentialRand::stairWidth[257] = {0};
-long double ExponentialRand::stairHeight[256] = {0};
-bool ExponentialRand::dummy = ExponentialRand::SetupTables();
+/// ziggurat of 256 stairs, built at compile time
+static constexpr ZigguratTable ZIGGURAT = ZigguratMath::exponentialTable();
 
 String ExponentialRand::Name() const
 {
     return "Exponential(" + toStringWithPrecision(GetRate()) + ")";
 }
 
-bool ExponentialRand::SetupTables()
-{
-    /// Set up ziggurat tables
-    static constexpr long double A = 3.9496598225815571993e-3l; /// area under rectangle
-    /// coordinates of the implicit rectangle in base layer
-    stairHeight[0] = 0.00045413435384149675l; /// exp(-x1);
-    stairWidth[0] = 8.697117470131049720307l; /// A / stairHeight[0];
-    /// implicit value for the top layer
-    stairWidth[256] = 0;
-    stairWidth[1] = x1;
-    stairHeight[1] = 0.0009672692823271745203l;
-    for (size_t i = 2; i < 256; ++i) {
-        /// such y_i that f(x_{i+1}) = y_i
-        stairWidth[i] = -std::log(stairHeight[i - 1]);
-        stairHeight[i] = stairHeight[i - 1] + A / stairWidth[i];
-    }
-    return true;
-}
-
 double ExponentialRand::f(const double & x) const
 {
     return (x < 0.0) ? 0.0 : beta * std::exp(-beta * x);
@@ -55,26 +36,99 @@ double ExponentialRand::Variate() const
     return theta * StandardVariate();
 }
 
+template < typename RealType >
+void ExponentialRand::sampleZiggurat(std::vector<RealType> &outputData) const
+{
+    /// Ziggurat algorithm, applied to blocks of variates:
+    /// the fast test is done for the whole block in branch-free loop, which can be vectorized,
+    /// and the rare rejected candidates are collected in a queue and processed one by one
+    static constexpr size_t BLOCK_SIZE = 1024;
+    unsigned long long random[BLOCK_SIZE];
+    unsigned char accepted[BLOCK_SIZE];
+    size_t queue[BLOCK_SIZE];
+    /// horizontal coordinates are uniform variates, generated in bulk and scaled in place
+    UniformRand().Sample(outputData);
+    RandGenerator &engine = RandGenerator::Local();
+    RealType scale = theta;
+    size_t size = outputData.size();
+    for (size_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+        size_t blockSize = std::min(BLOCK_SIZE, size - begin);
+        RealType *output = outputData.data() + begin;
+        engine.Fill(random, blockSize);
+        for (size_t i = 0; i != blockSize; ++i) {
+            size_t stairId = random[i] & 255;
+            output[i] *= static_cast<RealType>(ZIGGURAT[stairId].width);
+            accepted[i] = (output[i] < static_cast<RealType>(ZIGGURAT[stairId + 1].width));
+        }
+        size_t queueSize = 0;
+        for (size_t i = 0; i != blockSize; ++i) {
+            queue[queueSize] = i;
+            queueSize += !accepted[i];
+        }
+        for (size_t j = 0; j != queueSize; ++j) {
+            size_t i = queue[j];
+            int stairId = random[i] & 255;
+            if (stairId == 0) /// tail is shifted exponential variate
+                output[i] = x1 + StandardVariate();
+            else if (!acceptWedge(stairId, output[i]))
+                output[i] = StandardVariate();
+        }
+        for (size_t i = 0; i != blockSize; ++i)
+            output[i] *= scale;
+    }
+}
+
 void ExponentialRand::Sample(std::vector<double> &outputData) const
 {
-    for (double & var : outputData)
-        var = this->Variate();
+    sampleZiggurat(outputData);
+}
+
+void ExponentialRand::Sample(std::vector<float> &outputData) const
+{
+    sampleZiggurat(outputData);
+}
+
+void ExponentialRand::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float rate = beta;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = (x[i] < 0.0f) ? 0.0f : rate * std::exp(-rate * x[i]);
+}
+
+void ExponentialRand::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float rate = beta;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = (x[i] > 0.0f) ? -std::expm1(-rate * x[i]) : 0.0f;
+}
+
+bool ExponentialRand::acceptWedge(int stairId, double x)
+{
+    return UniformRand::Variate(ZIGGURAT[stairId - 1].height, ZIGGURAT[stairId].height) < std::exp(-x);
 }
 
 double ExponentialRand::StandardVariate()
 {
     /// Ziggurat algorithm
+    /// tail is shifted exponential variate, so every hit of the tail shifts the result
+    double shift = 0.0;
     int iter = 0;
     do {
         int stairId = RandGenerator::Variate() & 255;
         /// Get horizontal coordinate
-        double x = UniformRand::StandardVariate() * stairWidth[stairId];
-        if (x < stairWidth[stairId + 1]) /// if we are under the upper stair - accept
-            return x;
+        double x = UniformRand::StandardVariate() * ZIGGURAT[stairId].width;
+        if (x < ZIGGURAT[stairId + 1].width) /// if we are under the upper stair - accept
+            return shift + x;
         if (stairId == 0) /// if we catch the tail
-            return x1 + StandardVariate();
-        if (UniformRand::Variate(stairHeight[stairId - 1], stairHeight[stairId]) < std::exp(-x)) /// if we are under the curve - accept
-            return x;
+            shift += x1;
+        else if (acceptWedge(stairId, x)) /// if we are under the curve - accept
+            return shift + x;
         /// rejection - go back
     } while (++iter <= MAX_ITER_REJECTION);
     /// fail due to some error
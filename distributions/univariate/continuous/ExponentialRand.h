@@ -16,11 +16,24 @@
  */
 class RANDLIBSHARED_EXPORT ExponentialRand : public FreeScaleGammaDistribution
 {
-    /// Tables for ziggurat
-    static long double stairWidth[257], stairHeight[256];
+    /// starting point for ziggurat's setup
     static constexpr long double x1 = 7.69711747013104972l;
-    static bool dummy;
-    static bool SetupTables();
+
+    /**
+     * @fn acceptWedge
+     * @param stairId
+     * @param x candidate, rejected by the fast test
+     * @return true if x is under the curve in the wedge of given stair
+     */
+    static bool acceptWedge(int stairId, double x);
+
+    /**
+     * @fn sampleZiggurat
+     * fill vector by variates, using ziggurat algorithm for blocks of variates
+     * @param outputData
+     */
+    template < typename RealType >
+    void sampleZiggurat(std::vector<RealType> &outputData) const;
 
 public:
     explicit ExponentialRand(double rate = 1) : FreeScaleGammaDistribution(1, rate) {}
@@ -35,9 +48,16 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using FreeScaleGammaDistribution::Variate;
+    using FreeScaleGammaDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
+    void Sample(std::vector<float> &outputData) const override;
     static double StandardVariate();
+    using FreeScaleGammaDistribution::ProbabilityDensityFunction;
+    using FreeScaleGammaDistribution::CumulativeDistributionFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    void CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const override;
 
     double Median() const override;
 
@@ -41,6 +41,7 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using ContinuousDistribution::Variate;
     double Variate() const override;
     static double StandardVariate();
 
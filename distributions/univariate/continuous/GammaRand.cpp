@@ -51,6 +51,20 @@ double GammaDistribution::f(const double & x) const
     return std::exp(logf(x));
 }
 
+void GammaDistribution::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    /// terms of logarithm of density grow with shape and cancel each other,
+    /// hence it is evaluated in double precision and rounded once
+    double shapem1 = alpha - 1.0;
+    for (size_t i = 0; i != size; ++i) {
+        double xD = x[i];
+        y[i] = (xD > 0.0) ? std::exp(shapem1 * std::log(xD) - beta * xD + pdfCoef) : f(xD);
+    }
+}
+
 double GammaDistribution::logf(const double & x) const
 {
     if (x < 0.0)
@@ -250,6 +264,9 @@ double GammaDistribution::Variate() const
 
 void GammaDistribution::Sample(std::vector<double> &outputData) const
 {
+    /// for shape 1 exponential ziggurat is faster, for larger shapes rejection from hat is faster
+    if (alpha > 1 && sampleByRejection(outputData))
+        return;
     GENERATOR_ID genId = getIdOfUsedGenerator(alpha);
 
     switch(genId) {
@@ -43,6 +43,7 @@ public:
     SUPPORT_TYPE SupportType() const override { return RIGHTSEMIFINITE_T; }
     double MinValue() const override { return 0; }
     double MaxValue() const override { return INFINITY; }
+    bool IsLogConcave() const override { return alpha >= 1; }
 
 protected:
     /**
@@ -93,6 +94,8 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double logF(const double &x) const;
+    using ContinuousDistribution::ProbabilityDensityFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
     double S(const double & x) const override;
     double logS(const double & x) const;
     
@@ -154,6 +157,8 @@ public:
      * @return gamma variate with shape α and unity rate
      */
     static double StandardVariate(double shape);
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     /**
      * @fn Variate
      * @param shape α
@@ -81,6 +81,8 @@ private:
     double variateForOneHalfExponent(double z) const;
     double variateByCauchy(double z) const;
 public:
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
@@ -56,6 +56,14 @@ double GumbelRand::Variate() const
     return mu + beta * GumbelRand::StandardVariate();
 }
 
+void GumbelRand::Sample(std::vector<double> &outputData) const
+{
+    /// transformation of exponential variates is faster than generic rejection for log-concave densities
+    ExponentialRand().Sample(outputData);
+    for (double & var : outputData)
+        var = mu - beta * std::log(var);
+}
+
 double GumbelRand::StandardVariate()
 {
     double w = ExponentialRand::StandardVariate();
@@ -31,6 +31,7 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using ContinuousDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
@@ -32,6 +32,7 @@ public:
     double f(const double & x) const override;
     double logf(const double & x) const override;
     double F(const double & x) const override;
+    using ContinuousDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
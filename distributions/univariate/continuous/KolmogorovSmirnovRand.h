@@ -34,6 +34,7 @@ private:
     double variateForTheLeftMostInterval() const;
     double variateForTheRightMostInterval() const;
 public:
+    using ContinuousDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
@@ -28,6 +28,8 @@ public:
     double F(const double & x) const override;
     double S(const double & x) const override;
 
+    using ShiftedGeometricStableDistribution::Variate;
+    using ShiftedGeometricStableDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
@@ -27,6 +27,7 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using StableDistribution::Variate;
     double Variate() const override;
 
     static double StandardVariate();
@@ -59,6 +59,43 @@ double LogNormalRand::Variate() const
     return std::exp(X.Variate());
 }
 
+void LogNormalRand::Sample(std::vector<double> &outputData) const
+{
+    X.Sample(outputData);
+    for (double & var : outputData)
+        var = std::exp(var);
+}
+
+void LogNormalRand::Sample(std::vector<float> &outputData) const
+{
+    X.Sample(outputData);
+    for (float & var : outputData)
+        var = std::exp(var);
+}
+
+void LogNormalRand::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    double sigma = X.GetScale();
+    float location = X.GetLocation(), halfPrecision = 0.5 / (sigma * sigma), coef = M_1_SQRT2PI / sigma;
+    for (size_t i = 0; i != size; ++i) {
+        float z = std::log(x[i]) - location;
+        y[i] = (x[i] > 0.0f) ? coef / x[i] * std::exp(-halfPrecision * z * z) : 0.0f;
+    }
+}
+
+void LogNormalRand::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = X.GetLocation(), coef = M_SQRT1_2 / X.GetScale();
+    for (size_t i = 0; i != size; ++i)
+        y[i] = (x[i] > 0.0f) ? 0.5f * std::erfc(coef * (location - std::log(x[i]))) : 0.0f;
+}
+
 double LogNormalRand::Mean() const
 {
     return expMu * expHalfSigmaSq;
@@ -36,9 +36,17 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using ContinuousDistribution::ProbabilityDensityFunction;
+    using ContinuousDistribution::CumulativeDistributionFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    void CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const override;
 
     static double StandardVariate();
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
+    void Sample(std::vector<double> &outputData) const override;
+    void Sample(std::vector<float> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -60,6 +60,45 @@ double LogisticRand::Variate() const
     return mu + s * std::log(1.0 / UniformRand::StandardVariate() - 1);
 }
 
+void LogisticRand::Sample(std::vector<double> &outputData) const
+{
+    /// inversion is faster than generic rejection for log-concave densities
+    UniformRand().Sample(outputData);
+    for (double & var : outputData)
+        var = mu + s * std::log(1.0 / var - 1);
+}
+
+void LogisticRand::Sample(std::vector<float> &outputData) const
+{
+    UniformRand().Sample(outputData);
+    float location = mu, scale = s;
+    for (float & var : outputData)
+        var = location + scale * std::log(1.0f / var - 1.0f);
+}
+
+void LogisticRand::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = mu, scale = s;
+    for (size_t i = 0; i != size; ++i) {
+        float numerator = std::exp((location - x[i]) / scale);
+        float denominator = 1.0f + numerator;
+        y[i] = numerator / (scale * denominator * denominator);
+    }
+}
+
+void LogisticRand::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = mu, scale = s;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = 1.0f / (1.0f + std::exp((location - x[i]) / scale));
+}
+
 double LogisticRand::Mean() const
 {
     return mu;
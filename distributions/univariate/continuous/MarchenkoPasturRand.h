@@ -65,6 +65,8 @@ private:
     double variateForHugeRatio() const;
 
 public:
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
@@ -60,6 +60,9 @@ double NakagamiDistribution::Variate() const
 
 void NakagamiDistribution::Sample(std::vector<double> &outputData) const
 {
+    /// for shape 1 exponential ziggurat is faster, otherwise rejection from hat is faster
+    if (m != 1 && sampleByRejection(outputData))
+        return;
     Y.Sample(outputData);
     for (double & var : outputData)
         var = std::sqrt(var);
@@ -231,6 +234,8 @@ double MaxwellBoltzmannRand::Variate() const
 
 void MaxwellBoltzmannRand::Sample(std::vector<double> &outputData) const
 {
+    if (sampleByRejection(outputData))
+        return;
     for (double & var : outputData)
         var = this->Variate();
 }
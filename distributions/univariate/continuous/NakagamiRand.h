@@ -27,6 +27,7 @@ public:
     SUPPORT_TYPE SupportType() const override { return RIGHTSEMIFINITE_T; }
     double MinValue() const override { return 0; }
     double MaxValue() const override { return INFINITY; }
+    bool IsLogConcave() const override { return m >= 0.5; }
 
 protected:
     /**
@@ -62,6 +63,8 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
@@ -160,6 +163,8 @@ public:
     double f(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using NakagamiDistribution::Variate;
+    using NakagamiDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
@@ -204,6 +209,8 @@ public:
     double f(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using NakagamiDistribution::Variate;
+    using NakagamiDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
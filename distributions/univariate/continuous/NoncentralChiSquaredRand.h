@@ -48,6 +48,8 @@ private:
     double variateForDegreeEqualOne() const;
 
 public:
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     static double Variate(double degree, double noncentrality);
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
@@ -4,10 +4,10 @@
 #include "../BasicRandGenerator.h"
 #include "GammaRand.h"
 #include "StudentTRand.h"
+#include "ZigguratTables.h"
 
-long double NormalRand::stairWidth[257] = {0};
-long double NormalRand::stairHeight[256] = {0};
-const bool NormalRand::dummy = NormalRand::SetupTables();
+/// ziggurat of 256 stairs, built at compile time
+static constexpr ZigguratTable ZIGGURAT = ZigguratMath::normalTable();
 
 NormalRand::NormalRand(double mean, double var)
     : StableDistribution(2.0, 0.0, 1.0, mean)
@@ -28,24 +28,6 @@ void NormalRand::SetScale(double scale)
     StableDistribution::SetScale(sigma * M_SQRT1_2);
 }
 
-bool NormalRand::SetupTables()
-{
-    static constexpr long double A = 4.92867323399e-3l; /// area under rectangle
-    /// coordinates of the implicit rectangle in base layer
-    stairHeight[0] = 0.001260285930498597l; /// exp(-0.5 * x1 * x1);
-    stairWidth[0] = 3.9107579595370918075l; /// A / stairHeight[0];
-    /// implicit value for the top layer
-    stairWidth[256] = 0.0l;
-    stairWidth[1] = x1;
-    stairHeight[1] = 0.002609072746106362l;
-    for (size_t i = 2; i <= 255; ++i) {
-        /// such y_i that f(x_{i+1}) = y_i
-        stairWidth[i] = std::sqrt(-2 * std::log(stairHeight[i - 1]));
-        stairHeight[i] = stairHeight[i - 1] + A / stairWidth[i];
-    }
-    return true;
-}
-
 void NormalRand::SetVariance(double var)
 {
     if (var <= 0.0)
@@ -78,6 +60,22 @@ double NormalRand::Variate() const
     return mu + sigma * StandardVariate();
 }
 
+bool NormalRand::acceptSlowPath(int stairId, double &x)
+{
+    if (stairId == 0) /// handle the base layer
+    {
+        double z;
+        do {
+            x = ExponentialRand::StandardVariate() / x1;
+            z = ExponentialRand::StandardVariate() - 0.5 * x * x;
+        } while (z <= 0);
+        x += x1;
+        return true;
+    }
+    /// handle the wedges of other stairs
+    return UniformRand::Variate(ZIGGURAT[stairId - 1].height, ZIGGURAT[stairId].height) < std::exp(-.5 * x * x);
+}
+
 double NormalRand::StandardVariate()
 {
     /// Ziggurat algorithm by George Marsaglia using 256 strips
@@ -85,38 +83,87 @@ double NormalRand::StandardVariate()
     do {
         unsigned long long B = RandGenerator::Variate();
         int stairId = B & 255;
-        double x = UniformRand::StandardVariate() * stairWidth[stairId]; /// Get horizontal coordinate
-        if (x < stairWidth[stairId + 1])
-            return ((signed)B > 0) ? x : -x;
-        if (stairId == 0) /// handle the base layer
-        {
-            static double z = -1;
-            if (z > 0) /// we don't have to generate another exponential variable as we already have one
-            {
-                x = ExponentialRand::StandardVariate() / x1;
-                z -= 0.5 * x * x;
-            }
-            if (z <= 0) /// if previous generation wasn't successful
-            {
-                do {
-                    x = ExponentialRand::StandardVariate() / x1;
-                    z = ExponentialRand::StandardVariate() - 0.5 * x * x; /// we storage this value as after acceptance it becomes exponentially distributed
-                } while (z <= 0);
-            }
-            x += x1;
-            return ((signed)B > 0) ? x : -x;
-        }
-        /// handle the wedges of other stairs
-        if (UniformRand::Variate(stairHeight[stairId - 1], stairHeight[stairId]) < std::exp(-.5 * x * x))
+        double x = UniformRand::StandardVariate() * ZIGGURAT[stairId].width; /// Get horizontal coordinate
+        if (x < ZIGGURAT[stairId + 1].width || acceptSlowPath(stairId, x))
             return ((signed)B > 0) ? x : -x;
     } while (++iter <= MAX_ITER_REJECTION);
     return NAN; /// fail due to some error
 }
 
+template < typename RealType >
+void NormalRand::sampleZiggurat(std::vector<RealType> &outputData) const
+{
+    /// Ziggurat algorithm, applied to blocks of variates:
+    /// the fast test is done for the whole block in branch-free loop, which can be vectorized,
+    /// and the rare rejected candidates are collected in a queue and processed one by one
+    static constexpr size_t BLOCK_SIZE = 1024;
+    unsigned long long random[BLOCK_SIZE];
+    unsigned char accepted[BLOCK_SIZE];
+    size_t queue[BLOCK_SIZE];
+    /// horizontal coordinates are uniform variates, generated in bulk and scaled in place
+    UniformRand().Sample(outputData);
+    RandGenerator &engine = RandGenerator::Local();
+    RealType location = mu, scale = sigma;
+    size_t size = outputData.size();
+    for (size_t begin = 0; begin < size; begin += BLOCK_SIZE) {
+        size_t blockSize = std::min(BLOCK_SIZE, size - begin);
+        RealType *output = outputData.data() + begin;
+        engine.Fill(random, blockSize);
+        for (size_t i = 0; i != blockSize; ++i) {
+            size_t stairId = random[i] & 255;
+            RealType x = output[i] * static_cast<RealType>(ZIGGURAT[stairId].width);
+            accepted[i] = (x < static_cast<RealType>(ZIGGURAT[stairId + 1].width));
+            output[i] = (random[i] & 256) ? -x : x;
+        }
+        size_t queueSize = 0;
+        for (size_t i = 0; i != blockSize; ++i) {
+            queue[queueSize] = i;
+            queueSize += !accepted[i];
+        }
+        for (size_t j = 0; j != queueSize; ++j) {
+            size_t i = queue[j];
+            double x = std::fabs(output[i]);
+            if (acceptSlowPath(random[i] & 255, x))
+                output[i] = (random[i] & 256) ? -x : x;
+            else
+                output[i] = StandardVariate();
+        }
+        for (size_t i = 0; i != blockSize; ++i)
+            output[i] = location + scale * output[i];
+    }
+}
+
 void NormalRand::Sample(std::vector<double> &outputData) const
 {
-    for (double & var : outputData)
-        var = this->Variate();
+    sampleZiggurat(outputData);
+}
+
+void NormalRand::Sample(std::vector<float> &outputData) const
+{
+    sampleZiggurat(outputData);
+}
+
+void NormalRand::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = mu, precision = GetPrecision();
+    float coef = M_1_SQRT2PI / sigma;
+    for (size_t i = 0; i != size; ++i) {
+        float z = x[i] - location;
+        y[i] = coef * std::exp(-0.5f * precision * z * z);
+    }
+}
+
+void NormalRand::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float location = mu, coef = M_SQRT1_2 / sigma;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = 0.5f * std::erfc(coef * (location - x[i]));
 }
 
 std::complex<double> NormalRand::CFImpl(double t) const
@@ -20,11 +20,25 @@ class RANDLIBSHARED_EXPORT NormalRand : public StableDistribution
 {
     double sigma = 1; ///< scale σ
 
-    static long double stairWidth[257]; ///< width of ziggurat's stairs
-    static long double stairHeight[256]; ///< height of ziggurat's stairs
     static constexpr long double x1 = 3.6541528853610088l; ///< starting point for ziggurat's setup
-    static const bool dummy;
-    static bool SetupTables();
+
+    /**
+     * @fn acceptSlowPath
+     * perform the test in the wedge of given stair or, for the base layer, replace x by variate from the tail.
+     * Should be called only for x, rejected by the fast test
+     * @param stairId
+     * @param x absolute value of candidate, replaced by tail variate for the base layer
+     * @return true if x is accepted
+     */
+    static bool acceptSlowPath(int stairId, double &x);
+
+    /**
+     * @fn sampleZiggurat
+     * fill vector by variates, using ziggurat algorithm for blocks of variates
+     * @param outputData
+     */
+    template < typename RealType >
+    void sampleZiggurat(std::vector<RealType> &outputData) const;
 
 public:
     NormalRand(double mean = 0, double var = 1);
@@ -53,6 +67,8 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using StableDistribution::Variate;
+    using StableDistribution::Sample;
     double Variate() const override;
     /**
      * @fn StandardVariate
@@ -60,6 +76,11 @@ public:
      */
     static double StandardVariate();
     void Sample(std::vector<double> &outputData) const override;
+    void Sample(std::vector<float> &outputData) const override;
+    using StableDistribution::ProbabilityDensityFunction;
+    using StableDistribution::CumulativeDistributionFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    void CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const override;
 
 private:
     double quantileImpl(double p) const override;
@@ -0,0 +1,306 @@
+#include "NumericalInversionRand.h"
+#include "UniformRand.h"
+
+NumericalInversionRand::NumericalInversionRand(const ContinuousDistribution &distribution, double uResolutionValue)
+{
+    SetDistribution(distribution, uResolutionValue);
+}
+
+String NumericalInversionRand::Name() const
+{
+    return "Inverted " + distributionName;
+}
+
+void NumericalInversionRand::SetDistribution(const ContinuousDistribution &distribution, double uResolutionValue)
+{
+    if (uResolutionValue < 1e-12 || uResolutionValue > 1e-5)
+        throw std::invalid_argument("Numerical inversion: u-resolution should be in interval [1e-12, 1e-5]");
+    /// tails, which are cut off, are much less than u-resolution
+    double tail = 0.05 * uResolutionValue;
+    double minValue = tailBoundary(distribution, tail, true), maxValue = tailBoundary(distribution, tail, false);
+    if (!(minValue < maxValue))
+        throw std::invalid_argument("Numerical inversion: can't find boundaries of distribution");
+
+    /// split support into intervals from left to right, adapting their lengths
+    std::vector<Interval> newIntervals;
+    double h = (maxValue - minValue) / 128;
+    double x = minValue;
+    double u = distribution.F(x), s = distribution.S(x);
+    while (x < maxValue) {
+        h = std::min(h, maxValue - x);
+        /// u-offsets are found from the nearest tail for better precision
+        bool leftHalf = (u <= 0.5);
+        auto offset = [&distribution, leftHalf, u, s] (double y)
+        {
+            return leftHalf ? distribution.F(y) - u : s - distribution.S(y);
+        };
+        Interval interval;
+        interval.u = u;
+        interval.x = x;
+        double error = interpolate(interval, h, offset);
+        if (!(error <= SAFETY_FACTOR * uResolutionValue)) {
+            /// the shortest interval contains 64 doubles
+            double minH = std::max(64 * std::numeric_limits<double>::epsilon() * std::fabs(x), std::numeric_limits<double>::min());
+            if (h > minH) {
+                h = std::max(0.8 * h, minH);
+                continue;
+            }
+            /// otherwise cdf changes too fast between neighbouring doubles, e.g. near a pole of density,
+            /// and the error is as small as double precision allows
+            if (!std::isfinite(error))
+                throw std::invalid_argument("Numerical inversion: density is too irregular to be interpolated");
+        }
+        newIntervals.push_back(interval);
+        x = (h == maxValue - x) ? maxValue : x + h;
+        u = distribution.F(x);
+        s = distribution.S(x);
+        h *= 1.3;
+    }
+
+    /// guide table of the same size as table of intervals
+    int m = newIntervals.size();
+    std::vector<int> newGuideTable(m);
+    int i = 0;
+    for (int j = 0; j != m; ++j) {
+        double p = static_cast<double>(j) / m;
+        while (i + 1 < m && newIntervals[i + 1].u <= p)
+            ++i;
+        newGuideTable[j] = i;
+    }
+
+    intervals = std::move(newIntervals);
+    guideTable = std::move(newGuideTable);
+    uResolution = uResolutionValue;
+    a = minValue;
+    b = maxValue;
+    distributionName = distribution.Name();
+
+    /// moments by Gauss-Legendre quadrature of quantile function
+    static constexpr double NODES[] = {-0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640};
+    static constexpr double WEIGHTS[] = {0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891};
+    double total = 0.0, sum = 0.0;
+    for (const Interval &interval : intervals) {
+        double halfLength = 0.5 * interval.uLength, derivative = 0.0;
+        for (int k = 0; k != 5; ++k)
+            sum += halfLength * WEIGHTS[k] * (interval.x + evaluate(interval, halfLength * (1.0 + NODES[k]), derivative));
+        total += interval.uLength;
+    }
+    mean = sum / total;
+    sum = 0.0;
+    for (const Interval &interval : intervals) {
+        double halfLength = 0.5 * interval.uLength, derivative = 0.0;
+        for (int k = 0; k != 5; ++k) {
+            double deviation = interval.x + evaluate(interval, halfLength * (1.0 + NODES[k]), derivative) - mean;
+            sum += halfLength * WEIGHTS[k] * deviation * deviation;
+        }
+    }
+    variance = sum / total;
+}
+
+double NumericalInversionRand::tailBoundary(const ContinuousDistribution &distribution, double tail, bool isLeft)
+{
+    auto tailProbability = [&distribution, isLeft] (double x)
+    {
+        return isLeft ? distribution.F(x) : distribution.S(x);
+    };
+    double center = distribution.Median();
+    if (!std::isfinite(center))
+        center = distribution.Mode();
+    if (!std::isfinite(center))
+        throw std::invalid_argument("Numerical inversion: can't find boundaries of distribution");
+    double bound = isLeft ? distribution.MinValue() : distribution.MaxValue();
+    double direction = isLeft ? -1.0 : 1.0;
+    double step = std::sqrt(distribution.Variance());
+    if (!std::isfinite(step) || step <= 0.0)
+        step = 1.0;
+
+    /// step out from the median, doubling the step, until probability of tail is small enough
+    double inner = center, outer = center;
+    do {
+        inner = outer;
+        outer = center + direction * step;
+        step *= 2;
+        if (isLeft ? outer <= bound : outer >= bound)
+            outer = bound;
+        if (!std::isfinite(outer))
+            throw std::invalid_argument("Numerical inversion: can't find boundaries of distribution");
+    } while (!(tailProbability(outer) < tail));
+
+    /// bisection brings the boundary closer, so that cdf doesn't vanish there
+    for (int iter = 0; iter != 2100 && !(tailProbability(outer) >= 0.1 * tail); ++iter) {
+        double middle = 0.5 * (inner + outer);
+        if (middle == inner || middle == outer)
+            break;
+        if (tailProbability(middle) < tail)
+            outer = middle;
+        else
+            inner = middle;
+    }
+    return outer;
+}
+
+double NumericalInversionRand::interpolate(Interval &interval, double h, const std::function<double (double)> &offset)
+{
+    /// Chebyshev nodes in x, which are mapped to nodes in u
+    double t[ORDER + 1], y[ORDER + 1];
+    t[0] = y[0] = 0.0;
+    for (int i = 1; i <= ORDER; ++i) {
+        y[i] = 0.5 * h * (1.0 - std::cos(M_PI * i / ORDER));
+        t[i] = offset(interval.x + y[i]);
+        /// interpolation of inverse function needs strictly increasing cdf
+        if (!(t[i] > t[i - 1]))
+            return INFINITY;
+    }
+
+    /// divided differences
+    for (int j = 1; j <= ORDER; ++j) {
+        for (int i = ORDER; i >= j; --i)
+            y[i] = (y[i] - y[i - 1]) / (t[i] - t[i - j]);
+    }
+    std::copy(t, t + ORDER, interval.node);
+    std::copy(y, y + ORDER + 1, interval.coef);
+    interval.uLength = t[ORDER];
+
+    /// the error is maximal somewhere between nodes, besides near a pole of density it is concentrated
+    /// at the end of interval and might not vanish there, hence it is also checked in the first and the last parts
+    /// at distances 4^(-k) of their lengths from the end, for k = 1, ..., 5
+    double probes[ORDER + 10];
+    for (int i = 0; i != ORDER; ++i)
+        probes[i] = 0.5 * (t[i] + t[i + 1]);
+    double fraction = 1.0;
+    for (int i = ORDER; i != ORDER + 10; i += 2) {
+        fraction *= 0.25;
+        probes[i] = fraction * t[1];
+        probes[i + 1] = t[ORDER] - fraction * (t[ORDER] - t[ORDER - 1]);
+    }
+    double error = 0.0;
+    for (double probe : probes) {
+        double derivative = 0.0;
+        double xProbe = interval.x + evaluate(interval, probe, derivative);
+        /// rounding of x to double changes cdf by f(x) ulp(x), which no interpolation can avoid
+        double rounding = std::fabs(xProbe) * std::numeric_limits<double>::epsilon() / derivative;
+        error = std::max(error, std::fabs(offset(xProbe) - probe) - rounding);
+    }
+    return error;
+}
+
+double NumericalInversionRand::evaluate(const Interval &interval, double t, double &derivative)
+{
+    /// Horner scheme for Newton polynomial and its derivative
+    double value = interval.coef[ORDER];
+    derivative = 0.0;
+    for (int i = ORDER - 1; i >= 0; --i) {
+        double dt = t - interval.node[i];
+        derivative = derivative * dt + value;
+        value = value * dt + interval.coef[i];
+    }
+    return value;
+}
+
+int NumericalInversionRand::findInterval(double x) const
+{
+    auto it = std::upper_bound(intervals.begin(), intervals.end(), x, [] (double value, const Interval &interval)
+    {
+        return value < interval.x;
+    });
+    return std::max(static_cast<int>(it - intervals.begin()) - 1, 0);
+}
+
+double NumericalInversionRand::findT(int i, double x, double &derivative) const
+{
+    /// Newton's method, safeguarded by bisection, as polynomial is increasing
+    const Interval &interval = intervals[i];
+    double target = x - interval.x;
+    double lower = 0.0, upper = interval.uLength;
+    double t = 0.5 * upper;
+    for (int iter = 0; iter != 100; ++iter) {
+        double value = evaluate(interval, t, derivative) - target;
+        if (value < 0.0)
+            lower = t;
+        else
+            upper = t;
+        double tNext = t - value / derivative;
+        if (!(tNext > lower && tNext < upper))
+            tNext = 0.5 * (lower + upper);
+        if (std::fabs(tNext - t) <= 1e-15 * interval.uLength)
+            return tNext;
+        t = tNext;
+    }
+    return t;
+}
+
+double NumericalInversionRand::inverse(double p) const
+{
+    int m = intervals.size();
+    int i = guideTable[std::max(std::min(static_cast<int>(p * m), m - 1), 0)];
+    while (i + 1 < m && intervals[i + 1].u <= p)
+        ++i;
+    const Interval &interval = intervals[i];
+    double t = std::min(std::max(p - interval.u, 0.0), interval.uLength), derivative = 0.0;
+    double x = interval.x + evaluate(interval, t, derivative);
+    return std::min(std::max(x, a), b);
+}
+
+double NumericalInversionRand::f(const double & x) const
+{
+    if (x < a || x > b)
+        return 0.0;
+    double derivative = 0.0;
+    findT(findInterval(x), x, derivative);
+    return (derivative > 0.0) ? 1.0 / derivative : 0.0;
+}
+
+double NumericalInversionRand::logf(const double & x) const
+{
+    return std::log(f(x));
+}
+
+double NumericalInversionRand::F(const double & x) const
+{
+    if (x < a)
+        return 0.0;
+    if (x >= b)
+        return 1.0;
+    int i = findInterval(x);
+    double derivative = 0.0;
+    return std::min(intervals[i].u + findT(i, x, derivative), 1.0);
+}
+
+double NumericalInversionRand::S(const double & x) const
+{
+    return 1.0 - F(x);
+}
+
+double NumericalInversionRand::Variate() const
+{
+    return inverse(UniformRand::StandardVariate());
+}
+
+void NumericalInversionRand::Sample(std::vector<double> &outputData) const
+{
+    /// generate uniform variates in place and transform them
+    UniformRand U;
+    U.Sample(outputData);
+    for (double & var : outputData)
+        var = inverse(var);
+}
+
+double NumericalInversionRand::Mean() const
+{
+    return mean;
+}
+
+double NumericalInversionRand::Variance() const
+{
+    return variance;
+}
+
+double NumericalInversionRand::quantileImpl(double p) const
+{
+    return inverse(p);
+}
+
+double NumericalInversionRand::quantileImpl1m(double p) const
+{
+    return inverse(1.0 - p);
+}
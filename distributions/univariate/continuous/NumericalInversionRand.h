@@ -0,0 +1,129 @@
+#ifndef NUMERICALINVERSIONRAND_H
+#define NUMERICALINVERSIONRAND_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The NumericalInversionRand class <BR>
+ * Distribution with quantile function, interpolated from any continuous distribution
+ * by polynomial interpolation of inverse cdf (PINV) of Derflinger, Hörmann and Leydold
+ *
+ * Support without tails of probability less than ε / 20 is split into intervals, and on each of them
+ * quantile function is approximated by Newton polynomial of order 5, such that |F(Q(u)) - u| < ε,
+ * hence after setup variates and quantiles take one table lookup and evaluation of polynomial.
+ * If cdf changes by more than ε between neighbouring doubles, e.g. near a pole of density
+ * at nonzero boundary of support, the error there is limited by double precision instead
+ *
+ * Notation: X ~ Inv(Y)
+ */
+class RANDLIBSHARED_EXPORT NumericalInversionRand : public ContinuousDistribution
+{
+    static constexpr int ORDER = 5; ///< order of interpolating polynomial
+    static constexpr double SAFETY_FACTOR = 0.9; ///< fraction of u-resolution, which is allowed at checked points
+
+    /**
+     * @brief The Interval struct
+     * Newton polynomial, interpolating x - x0 as a function of t = u - u0 on one interval
+     */
+    struct Interval {
+        double u; ///< cdf at the left end
+        double x; ///< the left end
+        double uLength; ///< cdf increment over interval
+        double node[ORDER]; ///< first nodes of interpolation in terms of t
+        double coef[ORDER + 1]; ///< coefficients of Newton polynomial
+    };
+
+    String distributionName = "";
+    double uResolution = 1e-10; ///< maximal error of cdf in quantiles
+    double a = 0; ///< min bound
+    double b = 1; ///< max bound
+    double mean = 0.5, variance = 1.0 / 12; ///< moments of interpolated distribution
+    std::vector<Interval> intervals{};
+    std::vector<int> guideTable{}; ///< the last interval, which starts not after j / m, for j = 0, ..., m - 1
+
+public:
+    /**
+     * @fn NumericalInversionRand
+     * @param distribution
+     * @param uResolutionValue ε, maximal error of cdf in quantiles, from 1e-12 to 1e-5
+     */
+    explicit NumericalInversionRand(const ContinuousDistribution &distribution, double uResolutionValue = 1e-10);
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return FINITE_T; }
+    double MinValue() const override { return a; }
+    double MaxValue() const override { return b; }
+
+    void SetDistribution(const ContinuousDistribution &distribution, double uResolutionValue = 1e-10);
+    inline double GetUResolution() const { return uResolution; }
+    inline size_t GetIntervalsNum() const { return intervals.size(); }
+
+    double f(const double & x) const override;
+    double logf(const double & x) const override;
+    double F(const double & x) const override;
+    double S(const double & x) const override;
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
+    double Variate() const override;
+    void Sample(std::vector<double> &outputData) const override;
+
+    double Mean() const override;
+    double Variance() const override;
+
+private:
+    /**
+     * @fn tailBoundary
+     * @param distribution
+     * @param tail
+     * @param isLeft
+     * @return point, such that probability of tail beyond it is less than tail
+     */
+    static double tailBoundary(const ContinuousDistribution &distribution, double tail, bool isLeft);
+
+    /**
+     * @fn interpolate
+     * build polynomial on interval [x, x + h] and estimate its precision
+     * @param interval with set left end and its cdf
+     * @param h length of interval
+     * @param offset function, returning F(y) - F(x)
+     * @return maximum of |F(Q(u)) - u| in the middle points between nodes and near the ends,
+     * without the error of rounding Q(u) to double, infinity if cdf doesn't increase
+     */
+    static double interpolate(Interval &interval, double h, const std::function<double (double)> &offset);
+
+    /**
+     * @fn evaluate
+     * @param interval
+     * @param t
+     * @param derivative value of derivative of polynomial at t
+     * @return value of polynomial at t
+     */
+    static double evaluate(const Interval &interval, double t, double &derivative);
+
+    /**
+     * @fn findInterval
+     * @param x
+     * @return index of interval, containing x
+     */
+    int findInterval(double x) const;
+
+    /**
+     * @fn findT
+     * @param i index of interval
+     * @param x
+     * @param derivative value of derivative of polynomial at the solution
+     * @return t, such that the polynomial of interval i equals to x
+     */
+    double findT(int i, double x, double &derivative) const;
+
+    /**
+     * @fn inverse
+     * @param p
+     * @return approximation of quantile
+     */
+    double inverse(double p) const;
+
+    double quantileImpl(double p) const override;
+    double quantileImpl1m(double p) const override;
+};
+
+#endif // NUMERICALINVERSIONRAND_H
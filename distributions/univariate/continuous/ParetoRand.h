@@ -46,6 +46,8 @@ private:
 
 public:
     static double StandardVariate(double shape);
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     static double Variate(double shape, double scale);
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
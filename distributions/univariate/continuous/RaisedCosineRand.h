@@ -23,6 +23,7 @@ public:
     SUPPORT_TYPE SupportType() const override { return FINITE_T; }
     double MinValue() const override { return mu - s; }
     double MaxValue() const override { return mu + s; }
+    bool IsLogConcave() const override { return true; }
 
 protected:
     void SetLocation(double location);
@@ -38,6 +39,7 @@ public:
     double S(const double & x) const override;
 
     static double StandardVariate();
+    using ContinuousDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
@@ -18,9 +18,11 @@ public:
     SUPPORT_TYPE SupportType() const override { return INFINITE_T; }
     double MinValue() const override { return -INFINITY; }
     double MaxValue() const override { return INFINITY; }
+    bool IsLogConcave() const override { return true; }
     double f(const double & x) const override;
     double logf(const double & x) const override;
     double F(const double & x) const override;
+    using ContinuousDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
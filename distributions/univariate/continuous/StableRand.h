@@ -343,6 +343,8 @@ private:
      */
     double variateForExponentEqualOneHalf() const;
 public:
+    using ContinuousDistribution::Variate;
+    using ContinuousDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
 
@@ -0,0 +1,215 @@
+#include "TransformedDensityRejection.h"
+#include "UniformRand.h"
+
+TransformedDensityRejection::TransformedDensityRejection(const ContinuousDistribution &logConcaveDistribution)
+    : distribution(logConcaveDistribution)
+{
+    double minValue = distribution.MinValue(), maxValue = distribution.MaxValue();
+    double mode = std::min(std::max(distribution.Mode(), minValue), maxValue);
+    logfShift = distribution.logf(mode);
+    if (!std::isfinite(logfShift))
+        throw std::invalid_argument("Transformed density rejection: density at mode should be positive and finite");
+    double scale = std::sqrt(distribution.Variance());
+    if (!std::isfinite(scale) || scale <= 0.0)
+        scale = 1.0;
+
+    /// initial construction points are at the mode and on both sides of it
+    addPoint(mode);
+    for (int k = 1; k <= 2; ++k) {
+        double left = mode - k * scale, right = mode + k * scale;
+        addPoint((left > minValue) ? left : minValue + (mode - minValue) * (1.0 - k / 3.0));
+        addPoint((right < maxValue) ? right : maxValue - (maxValue - mode) * (1.0 - k / 3.0));
+    }
+    if (points.size() < 3)
+        throw std::invalid_argument("Transformed density rejection: density should be positive in neighbourhood of the mode");
+
+    std::vector<double> excess;
+    buildHull(excess);
+    while (squeezeArea < MIN_SQUEEZE_RATIO * hatArea && points.size() < MAX_POINTS) {
+        /// derandomized adaptive rejection: all intervals with more than average excess are split at once
+        double threshold = (hatArea - squeezeArea) / excess.size();
+        std::vector<double> newPoints;
+        for (size_t region = 0; region != excess.size(); ++region) {
+            if (excess[region] >= threshold)
+                newPoints.push_back(splitPoint(region));
+        }
+        bool isAdded = false;
+        for (double x : newPoints) {
+            if (points.size() < MAX_POINTS && addPoint(x))
+                isAdded = true;
+        }
+        if (!isAdded)
+            break;
+        buildHull(excess);
+    }
+    if (!std::isfinite(hatArea) || !(squeezeArea > 0.0))
+        throw std::invalid_argument("Transformed density rejection: hat can't be built, density should be log-concave");
+
+    /// guide table of the same size as table of pieces
+    int m = pieces.size();
+    guideTable.resize(m);
+    int i = 0;
+    for (int j = 0; j != m; ++j) {
+        double area = hatArea * j / m;
+        while (cumulativeArea[i] <= area && i + 1 < m)
+            ++i;
+        guideTable[j] = i;
+    }
+}
+
+bool TransformedDensityRejection::addPoint(double x)
+{
+    if (!(x >= distribution.MinValue() && x <= distribution.MaxValue()))
+        return false;
+    auto it = std::lower_bound(points.begin(), points.end(), x);
+    if (it != points.end() && *it == x)
+        return false;
+    double logfX = distribution.logf(x) - logfShift;
+    if (!std::isfinite(logfX))
+        return false;
+    logfPoints.insert(logfPoints.begin() + (it - points.begin()), logfX);
+    points.insert(it, x);
+    return true;
+}
+
+void TransformedDensityRejection::addPiece(double anchor, double direction, double length, double logHatAnchor, double slope,
+                                           double logSqueezeAnchor, double squeezeSlope, size_t region, std::vector<double> &excess)
+{
+    /// integral of exp(slope * d) for d from 0 to length
+    auto integral = [length] (double rate)
+    {
+        if (!std::isfinite(length))
+            return (rate < 0.0) ? -1.0 / rate : INFINITY;
+        double y = rate * length;
+        return (std::fabs(y) < 1e-8) ? length * (1.0 + 0.5 * y) : length * std::expm1(y) / y;
+    };
+    Piece piece;
+    piece.anchor = anchor;
+    piece.direction = direction;
+    piece.length = length;
+    piece.hatAnchor = std::exp(logHatAnchor);
+    piece.slope = slope;
+    piece.squeezeAnchor = std::exp(logSqueezeAnchor);
+    piece.squeezeSlope = squeezeSlope;
+    piece.area = piece.hatAnchor * integral(slope);
+    /// logarithm of ratio of squeeze and hat is linear, hence its minimum is at one of the ends
+    piece.squeezeRatio = std::exp(logSqueezeAnchor - logHatAnchor + std::min(0.0, (squeezeSlope - slope) * length));
+    double pieceSqueezeArea = (piece.squeezeAnchor > 0.0) ? piece.squeezeAnchor * integral(squeezeSlope) : 0.0;
+    pieces.push_back(piece);
+    hatArea += piece.area;
+    squeezeArea += pieceSqueezeArea;
+    cumulativeArea.push_back(hatArea);
+    excess[region] += piece.area - pieceSqueezeArea;
+}
+
+void TransformedDensityRejection::buildHull(std::vector<double> &excess)
+{
+    size_t n = points.size();
+    std::vector<double> slopes(n - 1);
+    for (size_t j = 0; j != n - 1; ++j)
+        slopes[j] = (logfPoints[j + 1] - logfPoints[j]) / (points[j + 1] - points[j]);
+    pieces.clear();
+    cumulativeArea.clear();
+    hatArea = squeezeArea = 0.0;
+    excess.assign(n + 1, 0.0);
+
+    /// by concavity secants are below logarithm of density between their points and above it outside of them
+    double minValue = distribution.MinValue(), maxValue = distribution.MaxValue();
+    if (points[0] > minValue)
+        addPiece(points[0], -1.0, points[0] - minValue, logfPoints[0], -slopes[0], -INFINITY, 0.0, 0, excess);
+    for (size_t k = 1; k != n; ++k) {
+        double left = points[k - 1], right = points[k];
+        double logfLeft = logfPoints[k - 1], logfRight = logfPoints[k];
+        /// hat is the minimum of extensions of the previous and the next secants, they intersect at z
+        double z = left;
+        if (k == n - 1)
+            z = right;
+        else if (k > 1) {
+            double slopesDiff = slopes[k - 2] - slopes[k];
+            z = (slopesDiff > 0.0) ? left + (logfRight - logfLeft - slopes[k] * (right - left)) / slopesDiff : 0.5 * (left + right);
+            z = std::min(std::max(z, left), right);
+        }
+        if (z > left)
+            addPiece(left, 1.0, z - left, logfLeft, slopes[k - 2], logfLeft, slopes[k - 1], k, excess);
+        if (z < right)
+            addPiece(right, -1.0, right - z, logfRight, -slopes[k], logfRight, -slopes[k - 1], k, excess);
+    }
+    if (points[n - 1] < maxValue)
+        addPiece(points[n - 1], 1.0, maxValue - points[n - 1], logfPoints[n - 1], slopes[n - 2], -INFINITY, 0.0, n, excess);
+}
+
+double TransformedDensityRejection::splitPoint(size_t region) const
+{
+    size_t n = points.size();
+    if (region > 0 && region < n)
+        return 0.5 * (points[region - 1] + points[region]);
+    /// in tails the next point is at the distance, where hat decreases e times
+    double spread = points[n - 1] - points[0];
+    if (region == 0) {
+        double minValue = distribution.MinValue();
+        if (std::isfinite(minValue))
+            return 0.5 * (minValue + points[0]);
+        double slope = (logfPoints[1] - logfPoints[0]) / (points[1] - points[0]);
+        return points[0] - ((slope > 0.0) ? 1.0 / slope : spread);
+    }
+    double maxValue = distribution.MaxValue();
+    if (std::isfinite(maxValue))
+        return 0.5 * (points[n - 1] + maxValue);
+    double slope = (logfPoints[n - 1] - logfPoints[n - 2]) / (points[n - 1] - points[n - 2]);
+    return points[n - 1] + ((slope < 0.0) ? -1.0 / slope : spread);
+}
+
+bool TransformedDensityRejection::variateForUniforms(double U, double V, double &x) const
+{
+    /// choose piece by guide table and invert integral of hat on it
+    double area = U * hatArea;
+    int m = pieces.size();
+    int i = guideTable[std::min(static_cast<int>(U * m), m - 1)];
+    while (cumulativeArea[i] <= area && i + 1 < m)
+        ++i;
+    const Piece &piece = pieces[i];
+    double ratio = (area - cumulativeArea[i] + piece.area) / piece.hatAnchor;
+    double t = piece.slope * ratio;
+    double d = (std::fabs(t) < 1e-8) ? ratio * (1.0 - 0.5 * t) : ratio * std::log1p(t) / t;
+    d = std::min(d, piece.length);
+    x = piece.anchor + piece.direction * d;
+
+    /// immediate acceptance, if point is below squeeze everywhere on the interval
+    if (V <= piece.squeezeRatio)
+        return true;
+    /// hat at x equals to hatAnchor * (1 + t), density is evaluated only if x is above squeeze
+    double hat = V * piece.hatAnchor * (1.0 + t);
+    if (hat <= piece.squeezeAnchor * std::exp(piece.squeezeSlope * d))
+        return true;
+    return hat <= std::exp(distribution.logf(x) - logfShift);
+}
+
+double TransformedDensityRejection::Variate() const
+{
+    int iter = 0;
+    do {
+        double x = 0.0;
+        if (variateForUniforms(UniformRand::StandardVariate(), UniformRand::StandardVariate(), x))
+            return x;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return NAN; /// fail
+}
+
+void TransformedDensityRejection::Sample(std::vector<double> &outputData) const
+{
+    static constexpr size_t CHUNK_SIZE = 4096;
+    size_t size = outputData.size();
+    std::vector<double> uniforms(2 * std::min(CHUNK_SIZE, size));
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(2 * chunkSize);
+        U.Sample(uniforms);
+        for (size_t i = 0; i != chunkSize; ++i) {
+            /// the first attempt takes pregenerated uniforms, rare rejections fall back to scalar generation
+            double &var = outputData[begin + i];
+            if (!variateForUniforms(uniforms[2 * i], uniforms[2 * i + 1], var))
+                var = Variate();
+        }
+    }
+}
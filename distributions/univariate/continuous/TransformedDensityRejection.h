@@ -0,0 +1,123 @@
+#ifndef TRANSFORMEDDENSITYREJECTION_H
+#define TRANSFORMEDDENSITYREJECTION_H
+
+#include "ContinuousDistribution.h"
+
+/**
+ * @brief The TransformedDensityRejection class <BR>
+ * Generator of variates from any distribution with log-concave density,
+ * transformed density rejection of Hörmann with transformation T = log
+ *
+ * Logarithm of density is bounded from above by hat, made of secants between construction points,
+ * extended beyond them, and from below by squeeze, made of secants themselves.
+ * Hence hat is valid without derivatives of density and is piecewise exponential.
+ * Construction points are added, until area below squeeze is at least 99% of area below hat,
+ * so that density is evaluated for a small fraction of variates
+ *
+ * Distribution should outlive the generator
+ */
+class RANDLIBSHARED_EXPORT TransformedDensityRejection
+{
+    static constexpr size_t MAX_POINTS = 64; ///< maximal number of construction points
+    static constexpr double MIN_SQUEEZE_RATIO = 0.99; ///< ratio of areas below squeeze and hat, which is enough
+    static constexpr int MAX_ITER_REJECTION = 1000; ///< upper boundary for amount of iterations
+
+    /**
+     * @brief The Piece struct
+     * part of hat, which equals to exp(slope * |x - anchor|) * hatAnchor
+     * on interval between anchor and anchor + direction * length
+     */
+    struct Piece {
+        double anchor; ///< construction point, from which variates are generated
+        double direction; ///< 1 if anchor is the left end, -1 otherwise
+        double length; ///< length of interval, can be infinite
+        double hatAnchor; ///< hat at anchor
+        double slope; ///< slope of logarithm of hat in the direction from anchor
+        double squeezeAnchor; ///< squeeze at anchor, 0 if there is no squeeze
+        double squeezeSlope; ///< slope of logarithm of squeeze in the direction from anchor
+        double squeezeRatio; ///< minimum of ratio of squeeze and hat on interval
+        double area; ///< area below hat
+    };
+
+    const ContinuousDistribution &distribution;
+    double logfShift = 0; ///< logarithm of density at mode, which all values are divided by
+    std::vector<double> points{}; ///< construction points
+    std::vector<double> logfPoints{}; ///< shifted logarithm of density at construction points
+    std::vector<Piece> pieces{};
+    std::vector<double> cumulativeArea{}; ///< total area below hat up to the end of each piece
+    std::vector<int> guideTable{}; ///< the first piece, which ends after j / m of total area, for j = 0, ..., m - 1
+    double hatArea = 0; ///< area below hat
+    double squeezeArea = 0; ///< area below squeeze
+
+public:
+    /**
+     * @fn TransformedDensityRejection
+     * @param logConcaveDistribution
+     */
+    explicit TransformedDensityRejection(const ContinuousDistribution &logConcaveDistribution);
+
+    /**
+     * @fn GetPointsNum
+     * @return number of construction points
+     */
+    inline size_t GetPointsNum() const { return points.size(); }
+
+    /**
+     * @fn GetSqueezeRatio
+     * @return ratio of areas below squeeze and hat, lower bound of acceptance rate
+     */
+    inline double GetSqueezeRatio() const { return squeezeArea / hatArea; }
+
+    /**
+     * @fn Variate
+     * @return random variate from distribution
+     */
+    double Variate() const;
+
+    /**
+     * @fn Sample
+     * @param outputData random variates from distribution
+     */
+    void Sample(std::vector<double> &outputData) const;
+
+private:
+    /**
+     * @fn addPoint
+     * @param x
+     * @return true if x is new construction point with finite density
+     */
+    bool addPoint(double x);
+
+    /**
+     * @fn addPiece
+     * add piece of hat and squeeze, given their logarithms at anchor and slopes
+     * @param region index of interval between construction points
+     * @param excess area between hat and squeeze in each interval between construction points
+     */
+    void addPiece(double anchor, double direction, double length, double logHatAnchor, double slope,
+                  double logSqueezeAnchor, double squeezeSlope, size_t region, std::vector<double> &excess);
+
+    /**
+     * @fn buildHull
+     * @param excess area between hat and squeeze in each interval between construction points
+     */
+    void buildHull(std::vector<double> &excess);
+
+    /**
+     * @fn splitPoint
+     * @param region index of interval between construction points
+     * @return new construction point inside of this interval
+     */
+    double splitPoint(size_t region) const;
+
+    /**
+     * @fn variateForUniforms
+     * @param U uniform variate on [0, 1), which chooses the point below hat
+     * @param V uniform variate on [0, 1), which accepts or rejects it
+     * @param x the point, if accepted
+     * @return true if accepted
+     */
+    bool variateForUniforms(double U, double V, double &x) const;
+};
+
+#endif // TRANSFORMEDDENSITYREJECTION_H
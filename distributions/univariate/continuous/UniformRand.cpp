@@ -1,5 +1,142 @@
 #include "UniformRand.h"
 #include "../BasicRandGenerator.h"
+#include <cstring>
+#include <atomic>
+
+/// whether generator returns 64 random bits or only 32
+static constexpr bool IS_GENERATOR_64 = (RandGenerator::MaxValue() > 4294967295ULL);
+
+/**
+ * @brief The UniformConverter struct
+ * Branch-free transformation of random integers into standard uniform variates
+ */
+template < UNIFORM_CONVERSION Conversion >
+struct UniformConverter;
+
+template <>
+struct UniformConverter<OPEN_32>
+{
+    static constexpr size_t RANDOM_PER_VARIATE = 1;
+    static double Convert(const unsigned long long *random)
+    {
+        /// generates a random number on interval (0,1), using upper 32 bits
+        double x = static_cast<unsigned int>(random[0] >> (IS_GENERATOR_64 ? 32 : 0));
+        return (x + 0.5) / 4294967296.0;
+    }
+};
+
+template <>
+struct UniformConverter<HALF_CLOSED_32>
+{
+    static constexpr size_t RANDOM_PER_VARIATE = 1;
+    static double Convert(const unsigned long long *random)
+    {
+        /// generates a random number on interval [0,1), using upper 32 bits
+        double x = static_cast<unsigned int>(random[0] >> (IS_GENERATOR_64 ? 32 : 0));
+        return x / 4294967296.0;
+    }
+};
+
+template <>
+struct UniformConverter<CLOSED_32>
+{
+    static constexpr size_t RANDOM_PER_VARIATE = 1;
+    static double Convert(const unsigned long long *random)
+    {
+        /// generates a random number on interval [0,1], using upper 32 bits
+        double x = static_cast<unsigned int>(random[0] >> (IS_GENERATOR_64 ? 32 : 0));
+        return x / 4294967295.0;
+    }
+};
+
+template <>
+struct UniformConverter<HALF_CLOSED_53>
+{
+    static constexpr size_t RANDOM_PER_VARIATE = IS_GENERATOR_64 ? 1 : 2;
+    static double Convert(const unsigned long long *random)
+    {
+        double x;
+        if (IS_GENERATOR_64) {
+            /// generates a random number on [0,1) with 52-bit resolution, using 64-bit integer variate
+            unsigned long long a = random[0];
+            a = (a >> 12) | 0x3FF0000000000000ULL; /// Take upper 52 bit
+            std::memcpy(&x, &a, sizeof(x)); /// Make a double from bits
+            return x - 1.0;
+        }
+        /// generates a random number on [0,1) with 53-bit resolution, using 2 32-bit integer variate
+        unsigned int a = random[0] >> 6; /// Upper 26 bits
+        unsigned int b = random[RANDOM_PER_VARIATE - 1] >> 5; /// Upper 27 bits
+        x = (a * 134217728.0 + b) / 9007199254740992.0;
+        return x;
+    }
+};
+
+/**
+ * @fn standardSample
+ * generate raw random numbers in bulk, chunk by chunk, and convert them in a tight loop
+ * @param outputData
+ * @param size
+ * @param shift
+ * @param scale
+ */
+template < UNIFORM_CONVERSION Conversion >
+static void standardSample(double *outputData, size_t size, double shift, double scale)
+{
+    typedef UniformConverter<Conversion> Converter;
+    static constexpr size_t CHUNK_SIZE = 4096;
+    unsigned long long random[Converter::RANDOM_PER_VARIATE * CHUNK_SIZE];
+    RandGenerator &engine = RandGenerator::Local();
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        engine.Fill(random, Converter::RANDOM_PER_VARIATE * chunkSize);
+        double *output = outputData + begin;
+        for (size_t i = 0; i != chunkSize; ++i)
+            output[i] = shift + scale * Converter::Convert(random + Converter::RANDOM_PER_VARIATE * i);
+    }
+}
+
+/**
+ * @fn standardFloatSample
+ * generate uniform variates in single precision on interval (0,1) with 23-bit resolution,
+ * taking 32 random bits per variate, so that one 64-bit random number gives two variates
+ * @param outputData
+ * @param size
+ * @param shift
+ * @param scale
+ */
+static void standardFloatSample(float *outputData, size_t size, float shift, float scale)
+{
+    static constexpr size_t VARIATES_PER_RANDOM = IS_GENERATOR_64 ? 2 : 1;
+    static constexpr size_t CHUNK_SIZE = 4096;
+    unsigned long long random[CHUNK_SIZE];
+    RandGenerator &engine = RandGenerator::Local();
+    for (size_t begin = 0; begin < size; begin += VARIATES_PER_RANDOM * CHUNK_SIZE) {
+        size_t chunkSize = std::min(VARIATES_PER_RANDOM * CHUNK_SIZE, size - begin);
+        engine.Fill(random, (chunkSize + VARIATES_PER_RANDOM - 1) / VARIATES_PER_RANDOM);
+        float *output = outputData + begin;
+        for (size_t i = 0; i != chunkSize; ++i) {
+            unsigned int bits = random[i / VARIATES_PER_RANDOM] >> (32 * (i % VARIATES_PER_RANDOM));
+            /// (k + 0.5) / 2^23 is exact in single precision for k < 2^23
+            float x = (static_cast<int>(bits >> 9) + 0.5f) * 1.1920928955078125e-7f;
+            output[i] = shift + scale * x;
+        }
+    }
+}
+
+#ifdef UNIDBLRAND
+static constexpr UNIFORM_CONVERSION DEFAULT_CONVERSION = HALF_CLOSED_53;
+#elif defined(RANDGENERATOR64)
+static constexpr UNIFORM_CONVERSION DEFAULT_CONVERSION = HALF_CLOSED_53;
+#elif defined(UNICLOSEDRAND)
+static constexpr UNIFORM_CONVERSION DEFAULT_CONVERSION = CLOSED_32;
+#elif defined(UNIHALFCLOSEDRAND)
+static constexpr UNIFORM_CONVERSION DEFAULT_CONVERSION = HALF_CLOSED_32;
+#else
+static constexpr UNIFORM_CONVERSION DEFAULT_CONVERSION = OPEN_32;
+#endif
+
+/// conversion, used by StandardVariate() without template argument
+static std::atomic<UNIFORM_CONVERSION> currentConversion(DEFAULT_CONVERSION);
 
 UniformRand::UniformRand(double minValue, double maxValue) :
     BetaDistribution(1, 1, minValue, maxValue)
@@ -42,8 +179,43 @@ double UniformRand::Variate() const
 
 void UniformRand::Sample(std::vector<double> &outputData) const
 {
-    for (double & var : outputData)
-        var = this->Variate();
+    switch (GetConversion()) {
+    case OPEN_32:
+        return standardSample<OPEN_32>(outputData.data(), outputData.size(), a, bma);
+    case HALF_CLOSED_32:
+        return standardSample<HALF_CLOSED_32>(outputData.data(), outputData.size(), a, bma);
+    case CLOSED_32:
+        return standardSample<CLOSED_32>(outputData.data(), outputData.size(), a, bma);
+    default:
+        return standardSample<HALF_CLOSED_53>(outputData.data(), outputData.size(), a, bma);
+    }
+}
+
+void UniformRand::Sample(std::vector<float> &outputData) const
+{
+    standardFloatSample(outputData.data(), outputData.size(), a, bma);
+}
+
+void UniformRand::ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float lower = a, upper = b, density = bmaInv;
+    for (size_t i = 0; i != size; ++i)
+        y[i] = (x[i] < lower || x[i] > upper) ? 0.0f : density;
+}
+
+void UniformRand::CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const
+{
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    float lower = a, upper = b, density = bmaInv;
+    for (size_t i = 0; i != size; ++i) {
+        float z = std::min(std::max(x[i], lower), upper);
+        y[i] = density * (z - lower);
+    }
 }
 
 double UniformRand::Variate(double minValue, double maxValue)
@@ -51,40 +223,56 @@ double UniformRand::Variate(double minValue, double maxValue)
     return (minValue < maxValue) ? minValue + StandardVariate() * (maxValue - minValue) : NAN;
 }
 
+template < UNIFORM_CONVERSION Conversion >
 double UniformRand::StandardVariate()
 {
-#ifdef UNIDBLRAND
-    /// generates a random number on [0,1) with 53-bit resolution, using 2 32-bit integer variate
-    double x;
-    unsigned int a, b;
-    a = RandGenerator::Variate() >> 6; /// Upper 26 bits
-    b = RandGenerator::Variate() >> 5; /// Upper 27 bits
-    x = (a * 134217728.0 + b) / 9007199254740992.0;
-    return x;
-#elif defined(JLKISS64RAND)
-    /// generates a random number on [0,1) with 53-bit resolution, using 64-bit integer variate
-    double x;
-    unsigned long long a = RandGenerator::Variate();
-    a = (a >> 12) | 0x3FF0000000000000ULL; /// Take upper 52 bit
-    *(reinterpret_cast<unsigned long long *>(&x)) = a; /// Make a double from bits
-    return x - 1.0;
-#elif defined(UNICLOSEDRAND)
-    /// generates a random number on interval [0,1]
-    double x = RandGenerator::Variate();
-    return x / 4294967295.0;
-#elif defined(UNIHALFCLOSEDRAND)
-    /// generates a random number on interval [0,1)
-    double x = RandGenerator::Variate();
-    return x / 4294967296.0;
-#else
-    /// generates a random number on interval (0,1)
-    double x = RandGenerator::Variate();
-    x += 0.5;
-    x /= 4294967296.0;
-    return x;
-#endif
+    typedef UniformConverter<Conversion> Converter;
+    unsigned long long random[Converter::RANDOM_PER_VARIATE];
+    for (unsigned long long & var : random)
+        var = RandGenerator::Variate();
+    return Converter::Convert(random);
+}
+
+double UniformRand::StandardVariate()
+{
+    switch (GetConversion()) {
+    case OPEN_32:
+        return StandardVariate<OPEN_32>();
+    case HALF_CLOSED_32:
+        return StandardVariate<HALF_CLOSED_32>();
+    case CLOSED_32:
+        return StandardVariate<CLOSED_32>();
+    default:
+        return StandardVariate<HALF_CLOSED_53>();
+    }
 }
 
+template < UNIFORM_CONVERSION Conversion >
+void UniformRand::StandardSample(std::vector<double> &outputData)
+{
+    standardSample<Conversion>(outputData.data(), outputData.size(), 0.0, 1.0);
+}
+
+void UniformRand::SetConversion(UNIFORM_CONVERSION conversion)
+{
+    currentConversion.store(conversion, std::memory_order_relaxed);
+}
+
+UNIFORM_CONVERSION UniformRand::GetConversion()
+{
+    return currentConversion.load(std::memory_order_relaxed);
+}
+
+template double UniformRand::StandardVariate<OPEN_32>();
+template double UniformRand::StandardVariate<HALF_CLOSED_32>();
+template double UniformRand::StandardVariate<CLOSED_32>();
+template double UniformRand::StandardVariate<HALF_CLOSED_53>();
+
+template void UniformRand::StandardSample<OPEN_32>(std::vector<double> &);
+template void UniformRand::StandardSample<HALF_CLOSED_32>(std::vector<double> &);
+template void UniformRand::StandardSample<CLOSED_32>(std::vector<double> &);
+template void UniformRand::StandardSample<HALF_CLOSED_53>(std::vector<double> &);
+
 double UniformRand::Mean() const
 {
     return 0.5 * (b + a);
@@ -3,6 +3,17 @@
 
 #include "BetaRand.h"
 
+/**
+ * Interval and resolution of standard uniform variates,
+ * generated from random integers
+ */
+enum UNIFORM_CONVERSION {
+    OPEN_32, ///< (0, 1), 32 random bits
+    HALF_CLOSED_32, ///< [0, 1), 32 random bits
+    CLOSED_32, ///< [0, 1], 32 random bits
+    HALF_CLOSED_53 ///< [0, 1), 53 random bits (52 bits for 64-bit generators)
+};
+
 /**
  * @brief The UniformRand class <BR>
  * Uniform continuous distribution
@@ -31,12 +42,49 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using BetaDistribution::Variate;
+    using BetaDistribution::Sample;
     double Variate() const override;
     void Sample(std::vector<double> &outputData) const override;
+    void Sample(std::vector<float> &outputData) const override;
+    using BetaDistribution::ProbabilityDensityFunction;
+    using BetaDistribution::CumulativeDistributionFunction;
+    void ProbabilityDensityFunction(const std::vector<float> &x, std::vector<float> &y) const override;
+    void CumulativeDistributionFunction(const std::vector<float> &x, std::vector<float> &y) const override;
 
     static double Variate(double minValue, double maxValue);
+
+    /**
+     * @fn StandardVariate
+     * @return standard uniform variate with conversion, chosen at compile time
+     */
+    template < UNIFORM_CONVERSION Conversion >
     static double StandardVariate();
 
+    /**
+     * @fn StandardVariate
+     * @return standard uniform variate with conversion, chosen by SetConversion()
+     */
+    static double StandardVariate();
+
+    /**
+     * @fn StandardSample
+     * fill vector with standard uniform variates, converted in bulk
+     * @param outputData
+     */
+    template < UNIFORM_CONVERSION Conversion >
+    static void StandardSample(std::vector<double> &outputData);
+
+    /**
+     * @fn SetConversion
+     * set conversion for all following calls of StandardVariate() in the whole process.
+     * By default it is defined by macros: UNIDBLRAND or 64-bit generator set HALF_CLOSED_53,
+     * UNICLOSEDRAND sets CLOSED_32, UNIHALFCLOSEDRAND sets HALF_CLOSED_32, otherwise OPEN_32
+     * @param conversion
+     */
+    static void SetConversion(UNIFORM_CONVERSION conversion);
+    static UNIFORM_CONVERSION GetConversion();
+
     double Mean() const override;
     double Variance() const override;
     double Median() const override;
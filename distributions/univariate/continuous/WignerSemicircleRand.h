@@ -26,6 +26,7 @@ public:
     SUPPORT_TYPE SupportType() const override { return FINITE_T; }
     double MinValue() const override { return -R; }
     double MaxValue() const override { return R; }
+    bool IsLogConcave() const override { return true; }
 
     void SetRadius(double radius);
     inline double GetRadius() const { return R; }
@@ -34,6 +35,7 @@ public:
     double f(const double & x) const override;
     double logf(const double & x) const override;
     double F(const double & x) const override;
+    using ContinuousDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
@@ -0,0 +1,133 @@
+#ifndef ZIGGURATTABLES_H
+#define ZIGGURATTABLES_H
+
+#include <stddef.h>
+
+/**
+ * @brief The ZigguratStair struct
+ * Coordinates of one stair of ziggurat. Width and height, used together, are stored side by side
+ */
+struct ZigguratStair
+{
+    double width; ///< right boundary x_i of the stair
+    double height; ///< such y_i that f(x_{i+1}) = y_i
+};
+
+/**
+ * @brief The ZigguratTable struct
+ * Ziggurat of 256 stairs with implicit top layer, aligned to cache line
+ */
+struct alignas(64) ZigguratTable
+{
+    ZigguratStair stairs[257];
+
+    constexpr const ZigguratStair &operator[](size_t i) const { return stairs[i]; }
+};
+
+namespace ZigguratMath
+{
+static constexpr long double LN2 = 0.693147180559945309417232121458176568l;
+static constexpr long double SQRT2 = 1.41421356237309504880168872420969808l;
+
+/**
+ * @fn sqrt
+ * @param x non-negative
+ * @return square root of x, evaluated at compile time by Newton's method
+ */
+constexpr long double sqrt(long double x)
+{
+    if (x == 0.0l)
+        return 0.0l;
+    /// Newton's method converges monotonically from above, stop when it can't go further down
+    long double root = (x > 1.0l) ? x : 1.0l;
+    long double nextRoot = 0.5l * (root + x / root);
+    while (nextRoot < root) {
+        root = nextRoot;
+        nextRoot = 0.5l * (root + x / root);
+    }
+    return root;
+}
+
+/**
+ * @fn log
+ * @param x positive
+ * @return natural logarithm of x, evaluated at compile time
+ */
+constexpr long double log(long double x)
+{
+    /// x = m * 2^k with 1/√2 <= m <= √2
+    int k = 0;
+    while (x > SQRT2) {
+        x *= 0.5l;
+        ++k;
+    }
+    while (x < 0.5l * SQRT2) {
+        x *= 2.0l;
+        --k;
+    }
+    /// log(m) = 2 atanh((m - 1) / (m + 1)), where |(m - 1) / (m + 1)| < 0.172
+    long double t = (x - 1.0l) / (x + 1.0l), t2 = t * t;
+    long double term = t, sum = 0.0l;
+    for (int n = 1; n < 100; n += 2) {
+        sum += term / n;
+        term *= t2;
+    }
+    return 2.0l * sum + k * LN2;
+}
+
+/**
+ * @fn normalTable
+ * @return ziggurat for the density exp(-x^2 / 2)
+ */
+constexpr ZigguratTable normalTable()
+{
+    constexpr long double A = 4.92867323399e-3l; /// area under rectangle
+    constexpr long double x1 = 3.6541528853610088l; /// starting point
+    ZigguratTable table{};
+    /// coordinates of the implicit rectangle in base layer
+    table.stairs[0].height = 0.001260285930498597l; /// exp(-0.5 * x1 * x1);
+    table.stairs[0].width = 3.9107579595370918075l; /// A / stairHeight[0];
+    table.stairs[1].width = x1;
+    long double height = 0.002609072746106362l;
+    table.stairs[1].height = height;
+    for (size_t i = 2; i <= 255; ++i) {
+        long double width = sqrt(-2 * log(height));
+        height += A / width;
+        table.stairs[i].width = width;
+        table.stairs[i].height = height;
+    }
+    /// implicit value for the top layer
+    table.stairs[256].width = 0.0;
+    table.stairs[256].height = 1.0;
+    return table;
+}
+
+/**
+ * @fn exponentialTable
+ * @return ziggurat for the density exp(-x)
+ */
+constexpr ZigguratTable exponentialTable()
+{
+    constexpr long double A = 3.9496598225815571993e-3l; /// area under rectangle
+    constexpr long double x1 = 7.69711747013104972l; /// starting point
+    ZigguratTable table{};
+    /// coordinates of the implicit rectangle in base layer
+    table.stairs[0].height = 0.00045413435384149675l; /// exp(-x1);
+    table.stairs[0].width = 8.697117470131049720307l; /// A / stairHeight[0];
+    table.stairs[1].width = x1;
+    long double height = 0.0009672692823271745203l;
+    table.stairs[1].height = height;
+    for (size_t i = 2; i <= 255; ++i) {
+        long double width = -log(height);
+        height += A / width;
+        table.stairs[i].width = width;
+        table.stairs[i].height = height;
+    }
+    /// implicit value for the top layer
+    table.stairs[256].width = 0.0;
+    table.stairs[256].height = 1.0;
+    return table;
+}
+}
+
+#endif // ZIGGURATTABLES_H
@@ -28,6 +28,7 @@ public:
     double logf(const double & x) const override;
     double F(const double & x) const override;
     double S(const double & x) const override;
+    using CircularDistribution::Variate;
     double Variate() const override;
 
     double CircularMean() const override;
@@ -1,10 +1,15 @@
 #include "BernoulliRand.h"
 #include "../continuous/UniformRand.h"
 #include "../BasicRandGenerator.h"
+#include <bitset>
+
+/// whether generator returns 64 random bits or only 32
+static constexpr bool IS_GENERATOR_64 = (RandGenerator::MaxValue() > 4294967295ULL);
 
 BernoulliRand::BernoulliRand(double probability) : BinomialDistribution(1, probability)
 {
     boundary = q * RandGenerator::MaxValue();
+    SetProbabilityBits();
 }
 
 String BernoulliRand::Name() const
@@ -18,6 +23,16 @@ void BernoulliRand::SetProbability(double probability)
         throw std::invalid_argument("Bernoulli distribution: probability parameter should in interval [0, 1]");
     SetParameters(1, probability);
     boundary = q * RandGenerator::MaxValue();
+    SetProbabilityBits();
+}
+
+void BernoulliRand::SetProbabilityBits()
+{
+    /// p = 0 and p = 1 are handled separately
+    probabilityBits = (p > 0.0 && p < 1.0) ? std::ldexp(p, 64) : 0;
+    lowestBit = 0;
+    while (lowestBit < 63 && ((probabilityBits >> lowestBit) & 1) == 0)
+        ++lowestBit;
 }
 
 double BernoulliRand::P(const int & k) const
@@ -52,33 +67,74 @@ int BernoulliRand::Variate(double probability)
 
 int BernoulliRand::StandardVariate()
 {
-    static const size_t maxDecimals = RandGenerator::maxDecimals();
-    static size_t decimals = 1;
-    static unsigned long long X = 0;
-    if (decimals == 1)
-    {
-        /// refresh
-        decimals = maxDecimals;
-        X = RandGenerator::Variate();
-    }
-    else
-    {
-        --decimals;
-        X >>= 1;
-    }
-    return X & 1;
+    return RandGenerator::BitVariate();
 }
 
 void BernoulliRand::Sample(std::vector<int> &outputData) const
 {
-    if (p == 0.5) {
-        for (int & var : outputData)
-            var = StandardVariate();
+    /// generate packed variates chunk by chunk and unpack them
+    static constexpr size_t CHUNK_SIZE = 4096;
+    unsigned long long words[CHUNK_SIZE / 64];
+    size_t size = outputData.size();
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        SampleBits(words, chunkSize);
+        int *output = outputData.data() + begin;
+        for (size_t i = 0; i != chunkSize; ++i)
+            output[i] = GetBit(words, i);
+    }
+}
+
+void BernoulliRand::SampleBits(unsigned long long *words, size_t size) const
+{
+    size_t wordsNum = (size + 63) / 64;
+    if (p == 0.0 || p == 1.0) {
+        std::fill(words, words + wordsNum, (p == 0.0) ? 0ULL : ~0ULL);
     }
     else {
-        for (int & var : outputData)
-            var = this->Variate();
+        /// random numbers are taken in bulk, 32-bit generator needs two of them for one word
+        static constexpr size_t RANDOM_PER_WORD = IS_GENERATOR_64 ? 1 : 2;
+        static constexpr size_t CHUNK_SIZE = 1024;
+        unsigned long long random[CHUNK_SIZE];
+        size_t randomSize = 0, randomIndex = 0;
+        RandGenerator &engine = RandGenerator::Local();
+        for (size_t i = 0; i != wordsNum; ++i) {
+            /// bit j of U_k is the k-th binary digit of uniform variate for j-th lane,
+            /// the lane succeeds if its first digit, different from p, is smaller
+            unsigned long long result = 0, undecided = ~0ULL;
+            for (int bit = 63; bit >= lowestBit && undecided != 0; --bit) {
+                if (randomIndex == randomSize) {
+                    randomSize = std::min(CHUNK_SIZE, RANDOM_PER_WORD * 8 * (wordsNum - i));
+                    engine.Fill(random, randomSize);
+                    randomIndex = 0;
+                }
+                unsigned long long U = random[randomIndex++];
+                if (!IS_GENERATOR_64)
+                    U = (U << 32) | random[randomIndex++];
+                if ((probabilityBits >> bit) & 1) {
+                    result |= undecided & ~U;
+                    undecided &= U;
+                }
+                else
+                    undecided &= ~U;
+            }
+            /// the rest of undecided lanes are not smaller than p
+            words[i] = result;
+        }
     }
+    if (size & 63)
+        words[wordsNum - 1] &= (1ULL << (size & 63)) - 1;
+}
+
+size_t BernoulliRand::CountSuccesses(const unsigned long long *words, size_t size)
+{
+    size_t fullWords = size >> 6;
+    size_t count = 0;
+    for (size_t i = 0; i != fullWords; ++i)
+        count += std::bitset<64>(words[i]).count();
+    if (size & 63)
+        count += std::bitset<64>(words[fullWords] & ((1ULL << (size & 63)) - 1)).count();
+    return count;
 }
 
 double BernoulliRand::Entropy()
@@ -19,6 +19,14 @@
 class RANDLIBSHARED_EXPORT BernoulliRand : public BinomialDistribution
 {
     unsigned long long boundary = 0;///< coefficient for faster random number generation
+    unsigned long long probabilityBits = 0; ///< first 64 bits of binary expansion of p
+    int lowestBit = 63; ///< position of the lowest nonzero bit in probabilityBits
+
+    /**
+     * @fn SetProbabilityBits
+     * set binary expansion of p for bit-parallel generation
+     */
+    void SetProbabilityBits();
 
 public:
     explicit BernoulliRand(double probability = 0.5);
@@ -31,11 +39,40 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     double S(const int & k) const override;
+    using BinomialDistribution::Variate;
+    using BinomialDistribution::Sample;
     int Variate() const override;
     static int Variate(double probability);
     static int StandardVariate();
     void Sample(std::vector<int> &outputData) const override;
 
+    /**
+     * @fn SampleBits
+     * fill array by packed variates: bit j of words[i] is the (64i + j)-th variate,
+     * unused bits of the last word are zeros.
+     * 64 variates are generated at once by comparison of random words with binary expansion of p,
+     * which takes about 8 random words
+     * @param words array of (size + 63) / 64 words
+     * @param size amount of variates
+     */
+    void SampleBits(unsigned long long *words, size_t size) const;
+
+    /**
+     * @fn GetBit
+     * @param words packed variates
+     * @param i
+     * @return i-th variate
+     */
+    static int GetBit(const unsigned long long *words, size_t i) { return (words[i >> 6] >> (i & 63)) & 1; }
+
+    /**
+     * @fn CountSuccesses
+     * @param words packed variates
+     * @param size amount of variates
+     * @return amount of ones among the first size variates
+     */
+    static size_t CountSuccesses(const unsigned long long *words, size_t size);
+
     inline double Entropy();
 };
 
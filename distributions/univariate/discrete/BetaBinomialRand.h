@@ -35,6 +35,7 @@ public:
     double P(const int & k) const override;
     double logP(const int & k) const override;
     double F(const int & k) const override;
+    using DiscreteDistribution::Variate;
     int Variate() const override;
 
     double Mean() const override;
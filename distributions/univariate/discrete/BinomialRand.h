@@ -91,6 +91,8 @@ private:
     static int variateBernoulliSum(int number, double probability);
 
 public:
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
     static int Variate(int number, double probability);
     void Sample(std::vector<int> &outputData) const override;
@@ -23,6 +23,85 @@ void CategoricalRand::SetProbabilities(std::vector<double> &&probabilities)
     }
 
     K = prob.size();
+    SetupAliasTable();
+    SetupCumulativeSums();
+}
+
+void CategoricalRand::SetupAliasTable()
+{
+    aliasTable.resize(K);
+    /// split outcomes into those with probability less and more than average
+    std::vector<int> small, large;
+    for (int i = 0; i != K; ++i) {
+        aliasTable[i].threshold = K * prob[i];
+        aliasTable[i].alias = i;
+        if (aliasTable[i].threshold < 1.0)
+            small.push_back(i);
+        else
+            large.push_back(i);
+    }
+    /// fill every small column by the mass of some large one
+    while (!small.empty() && !large.empty()) {
+        int less = small.back(), more = large.back();
+        small.pop_back();
+        aliasTable[less].alias = more;
+        aliasTable[more].threshold -= 1.0 - aliasTable[less].threshold;
+        if (aliasTable[more].threshold < 1.0) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+    /// the rest differs from 1 only due to rounding errors
+    for (int i : small)
+        aliasTable[i].threshold = 1.0;
+    for (int i : large)
+        aliasTable[i].threshold = 1.0;
+}
+
+void CategoricalRand::SetupCumulativeSums()
+{
+    cdf.resize(K);
+    tail.resize(K);
+    double sum = 0.0, tailSum = 0.0;
+    for (int i = 0; i != K; ++i) {
+        sum += prob[i];
+        cdf[i] = sum;
+        tailSum += prob[K - 1 - i];
+        tail[i] = tailSum;
+    }
+    /// both sums reach 1 exactly, so that search never runs out of range
+    cdf[K - 1] = tail[K - 1] = 1.0;
+
+    /// in-order traversal of implicit tree visits nodes in increasing order
+    cdfSearchTree.resize(K + 1);
+    tailSearchTree.resize(K + 1);
+    searchTreeRank.resize(K + 1);
+    int rank = 0, node = 1;
+    std::vector<int> stack;
+    while (node <= K || !stack.empty()) {
+        for (; node <= K; node *= 2)
+            stack.push_back(node);
+        node = stack.back();
+        stack.pop_back();
+        cdfSearchTree[node] = cdf[rank];
+        tailSearchTree[node] = tail[rank];
+        searchTreeRank[node] = rank++;
+        node = 2 * node + 1;
+    }
+}
+
+int CategoricalRand::searchTreeLowerBound(const std::vector<double> &searchTree, double p) const
+{
+    /// branch-free descent: every level is one comparison,
+    /// and the first levels are shared by all searches, hence stay in cache
+    int node = 1;
+    while (node <= K)
+        node = 2 * node + (searchTree[node] < p);
+    /// the answer is the last node, where we turned left
+    while (node & 1)
+        node >>= 1;
+    node >>= 1;
+    return (node == 0) ? K - 1 : searchTreeRank[node];
 }
 
 double CategoricalRand::P(const int & k) const
@@ -39,24 +118,47 @@ double CategoricalRand::F(const int & k) const
 {
     if (k < 0)
         return 0.0;
-    if (k >= K)
+    if (k >= K - 1)
         return 1.0;
-    if (2 * k <= K) {
-        double sum = 0.0;
-        for (int i = 0; i <= k; ++i)
-            sum += prob[i];
-        return sum;
-    }
-    double sum = 1.0;
-    for (int i = K - 1; i > k; --i)
-        sum -= prob[i];
-    return sum;
+    return (2 * k <= K) ? cdf[k] : 1.0 - tail[K - 2 - k];
+}
+
+double CategoricalRand::S(const int & k) const
+{
+    if (k < 0)
+        return 1.0;
+    if (k >= K - 1)
+        return 0.0;
+    return (2 * k <= K) ? 1.0 - cdf[k] : tail[K - 2 - k];
 }
 
 int CategoricalRand::Variate() const
 {
-    double U = UniformRand::StandardVariate();
-    return quantileImpl(U);
+    /// Walker's alias method: choose column uniformly and then choose between outcome and its alias
+    int k = std::min(static_cast<int>(UniformRand::StandardVariate() * K), K - 1);
+    const AliasEntry &entry = aliasTable[k];
+    return (UniformRand::StandardVariate() < entry.threshold) ? k : entry.alias;
+}
+
+void CategoricalRand::Sample(std::vector<int> &outputData) const
+{
+    /// uniform variates are generated in bulk, chunk by chunk,
+    /// and alias lookups are done in branch-free loop, which can be vectorized
+    static constexpr size_t CHUNK_SIZE = 2048;
+    size_t size = outputData.size();
+    std::vector<double> uniforms(2 * std::min(CHUNK_SIZE, size));
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(2 * chunkSize);
+        U.Sample(uniforms);
+        int *output = outputData.data() + begin;
+        for (size_t i = 0; i != chunkSize; ++i) {
+            int k = std::min(static_cast<int>(uniforms[i] * K), K - 1);
+            const AliasEntry &entry = aliasTable[k];
+            output[i] = (uniforms[chunkSize + i] < entry.threshold) ? k : entry.alias;
+        }
+    }
 }
 
 double CategoricalRand::Mean() const
@@ -86,24 +188,12 @@ int CategoricalRand::Mode() const
 
 int CategoricalRand::quantileImpl(double p) const
 {
-    double sum = 0.0;
-    for (int i = 0; i != K; ++i) {
-        sum += prob[i];
-        if (sum >= p)
-            return i;
-    }
-    return K;
+    return searchTreeLowerBound(cdfSearchTree, p);
 }
 
 int CategoricalRand::quantileImpl1m(double p) const
 {
-    double sum = prob[K - 1];
-    for (int i = K - 2; i >= 0; --i) {
-        sum += prob[i];
-        if (sum >= p)
-            return i;
-    }
-    return 0.0;
+    return K - 1 - searchTreeLowerBound(tailSearchTree, p);
 }
 
 std::complex<double> CategoricalRand::CFImpl(double t) const
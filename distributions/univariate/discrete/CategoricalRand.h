@@ -20,6 +20,43 @@ class RANDLIBSHARED_EXPORT CategoricalRand : public DiscreteDistribution
     std::vector<double> prob{1.0}; ///< vector of probabilities
     int K = 1; ///< number of possible outcomes
 
+    /**
+     * @brief The AliasEntry struct
+     * Column of alias table: outcome k is taken with probability threshold, alias otherwise
+     */
+    struct AliasEntry {
+        double threshold;
+        int alias;
+    };
+    std::vector<AliasEntry> aliasTable{{1.0, 0}}; ///< table for Walker's alias method
+
+    /**
+     * @fn SetupAliasTable
+     * build alias table by Vose's algorithm in O(K) time
+     */
+    void SetupAliasTable();
+
+    std::vector<double> cdf{1.0}; ///< p_0 + ... + p_k, summed from the left
+    std::vector<double> tail{1.0}; ///< p_{K-1-r} + ... + p_{K-1}, summed from the right
+    /// the same sums in Eytzinger (breadth-first) order with 1-based indices for cache-friendly binary search
+    std::vector<double> cdfSearchTree{0.0, 1.0};
+    std::vector<double> tailSearchTree{0.0, 1.0};
+    std::vector<int> searchTreeRank{0, 0}; ///< position of every node of search tree in sorted order
+
+    /**
+     * @fn SetupCumulativeSums
+     * compute prefix and suffix sums of probabilities and their search trees in O(K) time
+     */
+    void SetupCumulativeSums();
+
+    /**
+     * @fn searchTreeLowerBound
+     * @param searchTree increasing sequence in Eytzinger order
+     * @param p
+     * @return the smallest rank of element, not less than p, or K - 1 if there is no such
+     */
+    int searchTreeLowerBound(const std::vector<double> &searchTree, double p) const;
+
 public:
     explicit CategoricalRand(std::vector<double>&& probabilities);
     String Name() const override;
@@ -33,7 +70,11 @@ public:
     double P(const int & k) const override;
     double logP(const int & k) const override;
     double F(const int & k) const override;
+    double S(const int & k) const override;
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -46,7 +46,7 @@ int DiscreteDistribution::quantileImpl(double p) const
 {
     /// We use quantile from sample as an initial guess
     static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<int> sample(SAMPLE_SIZE);
+    static thread_local std::vector<int> sample(SAMPLE_SIZE);
     this->Sample(sample);
     int index = p * SAMPLE_SIZE;
     std::nth_element(sample.begin(), sample.begin() + index, sample.end());
@@ -72,7 +72,7 @@ int DiscreteDistribution::quantileImpl1m(double p) const
 {
     /// We use quantile from sample as an initial guess
     static constexpr int SAMPLE_SIZE = 128;
-    static std::vector<int> sample(SAMPLE_SIZE);
+    static thread_local std::vector<int> sample(SAMPLE_SIZE);
     this->Sample(sample);
     int index = p * SAMPLE_SIZE;
     std::nth_element(sample.begin(), sample.begin() + index, sample.end(), std::greater<>());
@@ -0,0 +1,209 @@
+#include "DynamicCategoricalRand.h"
+#include "../continuous/UniformRand.h"
+
+DynamicCategoricalRand::DynamicCategoricalRand(std::vector<double>&& weightsValues)
+{
+    SetWeights(std::move(weightsValues));
+}
+
+String DynamicCategoricalRand::Name() const
+{
+    String str = "Dynamic Categorical(";
+    for (int i = 0; i != K - 1; ++i)
+        str += toStringWithPrecision(weights[i]) + ", ";
+    return str + toStringWithPrecision(weights[K - 1]) + ")";
+}
+
+void DynamicCategoricalRand::SetWeights(std::vector<double>&& weightsValues)
+{
+    if (weightsValues.size() == 0)
+        throw std::invalid_argument("Dynamic Categorical distribution: there should be at least one weight");
+    int positive = 0;
+    for (double weight : weightsValues) {
+        if (!(weight >= 0.0) || !std::isfinite(weight))
+            throw std::invalid_argument("Dynamic Categorical distribution: weights should be non-negative and finite");
+        positive += (weight > 0.0);
+    }
+    if (positive == 0)
+        throw std::invalid_argument("Dynamic Categorical distribution: at least one weight should be positive");
+
+    weights = std::move(weightsValues);
+    positiveWeights = positive;
+    K = weights.size();
+    topBit = 1;
+    while (2 * topBit <= K)
+        topBit *= 2;
+
+    /// build Fenwick tree in linear time: every node passes its sum to the parent
+    tree.assign(K + 1, 0.0);
+    std::copy(weights.begin(), weights.end(), tree.begin() + 1);
+    for (int i = 1; i <= K; ++i) {
+        int parent = i + (i & -i);
+        if (parent <= K)
+            tree[parent] += tree[i];
+    }
+}
+
+void DynamicCategoricalRand::UpdateWeight(int k, double weight)
+{
+    if (k < 0 || k >= K)
+        throw std::invalid_argument("Dynamic Categorical distribution: index of weight is out of range");
+    if (!(weight >= 0.0) || !std::isfinite(weight))
+        throw std::invalid_argument("Dynamic Categorical distribution: weights should be non-negative and finite");
+    int positive = positiveWeights - (weights[k] > 0.0) + (weight > 0.0);
+    if (positive == 0)
+        throw std::invalid_argument("Dynamic Categorical distribution: at least one weight should be positive");
+    positiveWeights = positive;
+    weights[k] = weight;
+    /// node sums are recomputed from children instead of adding the difference,
+    /// so that rounding errors don't accumulate and zero subtrees have exactly zero sum
+    for (int i = k + 1; i <= K; i += i & -i) {
+        double sum = weights[i - 1];
+        for (int child = i - 1; child > i - (i & -i); child -= child & -child)
+            sum += tree[child];
+        tree[i] = sum;
+    }
+}
+
+double DynamicCategoricalRand::prefixSum(int k) const
+{
+    double sum = 0.0;
+    for (int i = k; i > 0; i -= i & -i)
+        sum += tree[i];
+    return sum;
+}
+
+int DynamicCategoricalRand::findByWeight(double weight) const
+{
+    /// descend from the root, keeping the sum of skipped subtrees not bigger than weight
+    int position = 0;
+    for (int bit = topBit; bit != 0; bit >>= 1) {
+        int next = position + bit;
+        if (next <= K && tree[next] <= weight) {
+            position = next;
+            weight -= tree[next];
+        }
+    }
+    return nearestPositive(position);
+}
+
+int DynamicCategoricalRand::findByPrefixSum(double weight) const
+{
+    /// the same descent, but only subtrees with sum less than weight are skipped
+    int position = 0;
+    for (int bit = topBit; bit != 0; bit >>= 1) {
+        int next = position + bit;
+        if (next <= K && tree[next] < weight) {
+            position = next;
+            weight -= tree[next];
+        }
+    }
+    return nearestPositive(position);
+}
+
+int DynamicCategoricalRand::nearestPositive(int k) const
+{
+    /// rounding errors can only move the descent to the right,
+    /// onto outcomes of zero weight or beyond the last outcome
+    k = std::min(k, K - 1);
+    while (k > 0 && weights[k] == 0.0)
+        --k;
+    return k;
+}
+
+double DynamicCategoricalRand::GetTotalWeight() const
+{
+    return prefixSum(K);
+}
+
+double DynamicCategoricalRand::P(const int & k) const
+{
+    return (k < 0 || k >= K) ? 0.0 : weights[k] / GetTotalWeight();
+}
+
+double DynamicCategoricalRand::logP(const int & k) const
+{
+    return std::log(P(k));
+}
+
+double DynamicCategoricalRand::F(const int & k) const
+{
+    if (k < 0)
+        return 0.0;
+    if (k >= K - 1)
+        return 1.0;
+    return std::min(prefixSum(k + 1) / GetTotalWeight(), 1.0);
+}
+
+int DynamicCategoricalRand::Variate() const
+{
+    return findByWeight(UniformRand::StandardVariate() * GetTotalWeight());
+}
+
+void DynamicCategoricalRand::Sample(std::vector<int> &outputData) const
+{
+    /// total weight is computed once and uniform variates are generated in bulk
+    static constexpr size_t CHUNK_SIZE = 4096;
+    double total = GetTotalWeight();
+    size_t size = outputData.size();
+    std::vector<double> uniforms(std::min(CHUNK_SIZE, size));
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(chunkSize);
+        U.Sample(uniforms);
+        for (size_t i = 0; i != chunkSize; ++i)
+            outputData[begin + i] = findByWeight(uniforms[i] * total);
+    }
+}
+
+double DynamicCategoricalRand::Mean() const
+{
+    double sum = 0.0;
+    for (int i = 1; i != K; ++i)
+        sum += i * weights[i];
+    return sum / GetTotalWeight();
+}
+
+double DynamicCategoricalRand::Variance() const
+{
+    double mean = 0.0, secMom = 0.0;
+    for (int i = 1; i != K; ++i) {
+        double aux = i * weights[i];
+        mean += aux;
+        secMom += i * aux;
+    }
+    double total = GetTotalWeight();
+    mean /= total;
+    secMom /= total;
+    return secMom - mean * mean;
+}
+
+int DynamicCategoricalRand::Mode() const
+{
+    auto maxWeightIt = std::max_element(weights.begin(), weights.end());
+    return std::distance(weights.begin(), maxWeightIt);
+}
+
+int DynamicCategoricalRand::quantileImpl(double p) const
+{
+    return findByPrefixSum(p * GetTotalWeight());
+}
+
+int DynamicCategoricalRand::quantileImpl1m(double p) const
+{
+    double total = GetTotalWeight();
+    return findByPrefixSum(total - p * total);
+}
+
+std::complex<double> DynamicCategoricalRand::CFImpl(double t) const
+{
+    double re = 0.0;
+    double im = 0.0;
+    for (int i = 0; i != K; ++i) {
+        re += weights[i] * std::cos(t * i);
+        im += weights[i] * std::sin(t * i);
+    }
+    double total = GetTotalWeight();
+    return std::complex<double>(re / total, im / total);
+}
@@ -0,0 +1,103 @@
+#ifndef DYNAMICCATEGORICALRAND_H
+#define DYNAMICCATEGORICALRAND_H
+
+#include "DiscreteDistribution.h"
+
+/**
+ * @brief The DynamicCategoricalRand class <BR>
+ * Categorical distribution, defined by non-negative weights, which can be changed one by one
+ *
+ * P(X = k) = w_k / (w_0 + ... + w_{K-1}) for k = {0, ..., K-1}
+ *
+ * Weights are kept in Fenwick tree, hence sampling takes O(log K) time, update of one weight takes O(log^2 K) time
+ * and no normalization is ever needed
+ *
+ * Related distributions: <BR>
+ * X ~ Cat(w_0 / W, ..., w_{K-1} / W), where W = w_0 + ... + w_{K-1}
+ */
+class RANDLIBSHARED_EXPORT DynamicCategoricalRand : public DiscreteDistribution
+{
+    std::vector<double> weights{1.0}; ///< vector of weights
+    std::vector<double> tree{0.0, 1.0}; ///< Fenwick tree of weights with 1-based indices
+    int K = 1; ///< number of possible outcomes
+    int topBit = 1; ///< the highest power of 2, not bigger than K
+    int positiveWeights = 1; ///< number of outcomes with positive weight
+
+public:
+    explicit DynamicCategoricalRand(std::vector<double>&& weightsValues);
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return FINITE_T; }
+    int MinValue() const override { return 0; }
+    int MaxValue() const override { return K - 1; }
+
+    /**
+     * @fn SetWeights
+     * set all weights in O(K) time
+     * @param weightsValues
+     */
+    void SetWeights(std::vector<double>&& weightsValues);
+
+    /**
+     * @fn UpdateWeight
+     * set weight of outcome k in O(log^2 K) time
+     * @param k
+     * @param weight
+     */
+    void UpdateWeight(int k, double weight);
+
+    inline double GetWeight(int k) const { return weights[k]; }
+    inline const std::vector<double> &GetWeights() const { return weights; }
+
+    /**
+     * @fn GetTotalWeight
+     * @return sum of all weights
+     */
+    double GetTotalWeight() const;
+
+    double P(const int & k) const override;
+    double logP(const int & k) const override;
+    double F(const int & k) const override;
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
+    int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
+
+    double Mean() const override;
+    double Variance() const override;
+    int Mode() const override;
+
+private:
+    /**
+     * @fn prefixSum
+     * @param k
+     * @return w_0 + ... + w_{k-1}
+     */
+    double prefixSum(int k) const;
+
+    /**
+     * @fn findByWeight
+     * @param weight
+     * @return the smallest k, such that w_0 + ... + w_k > weight
+     */
+    int findByWeight(double weight) const;
+
+    /**
+     * @fn findByPrefixSum
+     * @param weight
+     * @return the smallest k, such that w_0 + ... + w_k >= weight
+     */
+    int findByPrefixSum(double weight) const;
+
+    /**
+     * @fn nearestPositive
+     * @param k
+     * @return the nearest outcome not bigger than k with positive weight
+     */
+    int nearestPositive(int k) const;
+
+    int quantileImpl(double p) const override;
+    int quantileImpl1m(double p) const override;
+    std::complex<double> CFImpl(double t) const override;
+};
+
+#endif // DYNAMICCATEGORICALRAND_H
@@ -27,6 +27,8 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     double S(const int & k) const override;
+    using NegativeBinomialDistribution<int>::Variate;
+    using NegativeBinomialDistribution<int>::Sample;
     int Variate() const override;
     static int Variate(double probability);
 
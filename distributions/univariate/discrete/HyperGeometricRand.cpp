@@ -1,4 +1,5 @@
 #include "HyperGeometricRand.h"
+#include "../continuous/UniformRand.h"
 
 HyperGeometricRand::HyperGeometricRand(int totalSize, int drawsNum, int successesNum)
 {
@@ -25,12 +26,41 @@ void HyperGeometricRand::SetParameters(int totalSize, int drawsNum, int successe
     n = drawsNum;
     K = successesNum;
 
-    p0 = static_cast<double>(K) / N;
     pmfCoef = RandMath::lfact(K);
     pmfCoef += RandMath::lfact(N - K);
     pmfCoef += RandMath::lfact(N - n);
     pmfCoef += RandMath::lfact(n);
     pmfCoef -= RandMath::lfact(N);
+
+    SetGeneratorConstants();
+}
+
+void HyperGeometricRand::SetGeneratorConstants()
+{
+    /// X ~ HG(N, K, n) => n - X ~ HG(N, N - K, n) and K - X ~ HG(N, K, N - n),
+    /// hence we can sample not more than half of population from the smaller group
+    sampleSize = std::min(n, N - n);
+    smallGroup = std::min(K, N - K);
+    largeGroup = N - smallGroup;
+
+    if (GetIdOfUsedGenerator() == INVERSION) {
+        probZero = std::exp(RandMath::lfact(largeGroup) + RandMath::lfact(N - sampleSize)
+                          - RandMath::lfact(largeGroup - sampleSize) - RandMath::lfact(N));
+        return;
+    }
+
+    /// table mountain hat of height 1 and width h, centered at the mean
+    static constexpr double D1 = 1.7155277699214135; /// 2 * sqrt(2 / e)
+    static constexpr double D2 = 0.8989161620588988; /// 3 - 2 * sqrt(3 / e)
+    double p = static_cast<double>(smallGroup) / N;
+    double q = static_cast<double>(largeGroup) / N;
+    double mu = sampleSize * p;
+    double var = static_cast<double>(N - sampleSize) * sampleSize * p * q / (N - 1);
+    a = mu + 0.5;
+    h = D1 * std::sqrt(var + 0.5) + D2;
+    int mode = std::floor((sampleSize + 1.0) * (smallGroup + 1.0) / (N + 2.0));
+    g = logPReduced(mode);
+    b = std::min(std::min(sampleSize, smallGroup) + 1.0, std::floor(a + 16 * std::sqrt(var + 0.5)));
 }
 
 double HyperGeometricRand::P(const int & k) const
@@ -70,18 +100,78 @@ double HyperGeometricRand::F(const int & k) const
     return sum;
 }
 
+HyperGeometricRand::GENERATOR_ID HyperGeometricRand::GetIdOfUsedGenerator() const
+{
+    /// inversion takes about mean + 1 steps
+    return (static_cast<double>(sampleSize) * smallGroup <= 10.0 * N) ? INVERSION : RATIO_OF_UNIFORMS;
+}
+
+double HyperGeometricRand::logPReduced(int k) const
+{
+    double y = RandMath::lfact(k);
+    y += RandMath::lfact(smallGroup - k);
+    y += RandMath::lfact(sampleSize - k);
+    y += RandMath::lfact(largeGroup - sampleSize + k);
+    return -y;
+}
+
+int HyperGeometricRand::variateInversion() const
+{
+    int maxK = std::min(sampleSize, smallGroup);
+    int iter = 0;
+    do {
+        /// sequential search, starting from zero
+        double U = UniformRand::StandardVariate();
+        double prob = probZero;
+        int k = 0;
+        while (U > prob && k < maxK) {
+            U -= prob;
+            prob *= static_cast<double>(smallGroup - k) * (sampleSize - k);
+            ++k;
+            prob /= static_cast<double>(k) * (largeGroup - sampleSize + k);
+        }
+        /// U can be left unexhausted only due to rounding errors
+        if (U <= prob)
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
+int HyperGeometricRand::variateRatioOfUniforms() const
+{
+    /// HRUA algorithm of Stadlober (1989)
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate();
+        double V = UniformRand::StandardVariate();
+        double X = a + h * (V - 0.5) / U;
+        if (X < 0.0 || X >= b)
+            continue;
+        int k = std::floor(X);
+        double T = logPReduced(k) - g;
+        /// squeeze acceptance
+        if (U * (4.0 - U) - 3.0 <= T)
+            return k;
+        /// squeeze rejection
+        if (U * (U - T) >= 1.0)
+            continue;
+        if (2.0 * std::log(U) <= T)
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
 int HyperGeometricRand::Variate() const
 {
-    double p = p0;
-    int sum = 0;
-    for (int i = 1; i <= n; ++i)
-    {
-        if (BernoulliRand::Variate(p) && ++sum >= K)
-            return sum;
-        p = K - sum;
-        p /= N - i;
-    }
-    return sum;
+    int X = (GetIdOfUsedGenerator() == INVERSION) ? variateInversion() : variateRatioOfUniforms();
+    if (X < 0)
+        return -1; /// fail due to some error
+    /// return to original parameters
+    if (K > N - K)
+        X = sampleSize - X;
+    if (sampleSize < n)
+        X = K - X;
+    return X;
 }
 
 double HyperGeometricRand::Mean() const
@@ -2,13 +2,15 @@
 #define HYPERGEOMETRICRAND_H
 
 #include "DiscreteDistribution.h"
-#include "BernoulliRand.h"
 
 /**
  * @brief The HyperGeometricRand class <BR>
  * Hypergeometric distribution
  *
  * X ~ HG(N, K, n)
+ *
+ * Variates are generated by inversion for small mean
+ * and by ratio-of-uniforms method of Stadlober (HRUA) otherwise
  */
 class RANDLIBSHARED_EXPORT HyperGeometricRand : public DiscreteDistribution
 {
@@ -16,7 +18,20 @@ class RANDLIBSHARED_EXPORT HyperGeometricRand : public DiscreteDistribution
     int K = 1; /// number of possible successes
     int n = 1; /// number of draws
     double pmfCoef = 1; ///< C(N, n)
-    double p0 = 1; ///< K/N
+
+    /// reduced parameters: sample of size min(n, N - n) from the smaller of two groups
+    int sampleSize = 1; ///< min(n, N - n)
+    int smallGroup = 1; ///< min(K, N - K)
+    int largeGroup = 0; ///< max(K, N - K)
+    double probZero = 1; ///< probability of zero in reduced parameters
+    /// constants for ratio-of-uniforms method
+    double a = 1, h = 1, g = 0, b = 1;
+
+    /**
+     * @fn SetGeneratorConstants
+     * reduce parameters and set constants of the chosen generator
+     */
+    void SetGeneratorConstants();
 
 public:
     HyperGeometricRand(int totalSize, int drawsNum, int successesNum);
@@ -33,6 +48,26 @@ public:
     double P(const int & k) const override;
     double logP(const int & k) const override;
     double F(const int & k) const override;
+private:
+    enum GENERATOR_ID {
+        INVERSION,
+        RATIO_OF_UNIFORMS
+    };
+
+    GENERATOR_ID GetIdOfUsedGenerator() const;
+
+    /**
+     * @fn logPReduced
+     * @param k
+     * @return logarithm of probability to get k in reduced parameters without normalization
+     */
+    double logPReduced(int k) const;
+
+    int variateInversion() const;
+    int variateRatioOfUniforms() const;
+
+public:
+    using DiscreteDistribution::Variate;
     int Variate() const override;
 
     double Mean() const override;
@@ -39,6 +39,7 @@ private:
 public:
     double F(const int & k) const override;
     double S(const int & k) const override;
+    using DiscreteDistribution::Variate;
     int Variate() const override;
 
     double Mean() const override;
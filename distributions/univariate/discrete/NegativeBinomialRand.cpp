@@ -159,8 +159,10 @@ int NegativeBinomialDistribution<int>::Variate() const
 template< >
 void NegativeBinomialDistribution<double>::Sample(std::vector<int> &outputData) const
 {
-    for (int &var : outputData)
-        var = variateThroughGammaPoisson();
+    /// draw all the rates of Gamma-Poisson mixture at once
+    std::vector<double> rates(outputData.size());
+    GammaRV.Sample(rates);
+    PoissonRand::Sample(rates.data(), outputData.data(), outputData.size());
 }
 
 template< >
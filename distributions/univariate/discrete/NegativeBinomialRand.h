@@ -70,6 +70,8 @@ private:
     int variateThroughGammaPoisson() const;
 
 public:
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
     void Sample(std::vector<int> &outputData) const override;
 
@@ -1,4 +1,7 @@
 #include "NegativeHyperGeometricRand.h"
+#include "../continuous/UniformRand.h"
+#include "../continuous/ExponentialRand.h"
+#include "BernoulliRand.h"
 
 NegativeHyperGeometricRand::NegativeHyperGeometricRand(int totalSize, int totalSuccessesNum, int limitSuccessesNum)
 {
@@ -27,12 +30,33 @@ void NegativeHyperGeometricRand::SetParameters(int totalSize, int totalSuccesses
 
     m = limitSuccessesNum;
 
-    p0 = static_cast<double>(M) / N;
     pmfCoef = RandMath::lfact(M);
     pmfCoef += RandMath::lfact(N - M);
     pmfCoef -= RandMath::lfact(m - 1);
     pmfCoef -= RandMath::lfact(M - m);
     pmfCoef -= RandMath::lfact(N);
+
+    /// distribution is unimodal, so we adjust the mean until the ratio of neighbours changes its sign
+    int maxVal = MaxValue();
+    mode = std::min(static_cast<int>(Mean()), maxVal);
+    while (mode < maxVal && ratioToNext(mode) > 1.0)
+        ++mode;
+    while (mode > 0 && ratioToNext(mode - 1) < 1.0)
+        --mode;
+    logPMode = logP(mode);
+    pMode = std::exp(logPMode);
+}
+
+NegativeHyperGeometricRand::GENERATOR_ID NegativeHyperGeometricRand::GetIdOfUsedGenerator() const
+{
+    /// search takes about 1.6 * sqrt(Var(X)) steps, rejection - about 4 evaluations of logP
+    return (Variance() <= 2500) ? SEARCH_FROM_MODE : REJECTION;
+}
+
+double NegativeHyperGeometricRand::ratioToNext(int k) const
+{
+    double ratio = static_cast<double>(k + m) * (N - M - k);
+    return ratio / (static_cast<double>(k + 1) * (N - m - k));
 }
 
 double NegativeHyperGeometricRand::P(const int & k) const
@@ -73,19 +97,123 @@ double NegativeHyperGeometricRand::F(const int & k) const
     return sum;
 }
 
+int NegativeHyperGeometricRand::variateFromMode(double U) const
+{
+    int maxVal = MaxValue();
+    U -= pMode;
+    if (U <= 0.0)
+        return mode;
+    int up = mode, down = mode;
+    double pUp = pMode, pDown = pMode;
+    while (up < maxVal || down > 0) {
+        if (up < maxVal) {
+            pUp *= ratioToNext(up++);
+            U -= pUp;
+            if (U <= 0.0)
+                return up;
+        }
+        if (down > 0) {
+            pDown /= ratioToNext(--down);
+            U -= pDown;
+            if (U <= 0.0)
+                return down;
+        }
+    }
+    return -1;
+}
+
+int NegativeHyperGeometricRand::variateRejection() const
+{
+    /// Devroye (1987), a simple generator for discrete log-concave distributions:
+    /// P(X = mode + k) ≤ P(X = mode) * min(1, exp(w - P(X = mode) * |y|)) for |y| ∈ [|k| - 0.5, |k| + 0.5]
+    int maxVal = MaxValue();
+    double w = 1.0 + 0.5 * pMode;
+    double flatProb = w / (1.0 + w);
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate();
+        double Y = (U <= flatProb) ? UniformRand::StandardVariate() * w / pMode : (w + ExponentialRand::StandardVariate()) / pMode;
+        int k = std::floor(Y + 0.5);
+        k = BernoulliRand::StandardVariate() ? mode + k : mode - k;
+        if (k < 0 || k > maxVal)
+            continue;
+        double logHat = std::min(0.0, w - pMode * Y);
+        if (std::log(UniformRand::StandardVariate()) + logHat <= logP(k) - logPMode)
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
 int NegativeHyperGeometricRand::Variate() const
 {
-    double p = p0;
-    int successesNum = 0;
-    int num = 0;
-    while (successesNum < m) {
-        ++num;
-        if (BernoulliRand::Variate(p) && ++successesNum == num - N + M)
-            return N - M;
-        p = M - successesNum;
-        p /= N - num;
+    if (GetIdOfUsedGenerator() == REJECTION)
+        return variateRejection();
+    int iter = 0;
+    do {
+        int X = variateFromMode(UniformRand::StandardVariate());
+        if (X >= 0)
+            return X;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1; /// fail due to some error
+}
+
+int NegativeHyperGeometricRand::variateOutOfTable(double U, int down, int up) const
+{
+    if (GetIdOfUsedGenerator() == SEARCH_FROM_MODE) {
+        /// continue the walk with the same U
+        int X = variateFromMode(U);
+        return (X >= 0) ? X : Variate();
+    }
+    /// table can be exceeded when it covers the whole support only due to rounding errors
+    if (down == 0 && up == MaxValue())
+        return Variate();
+    int X = -1;
+    int iter = 0;
+    do {
+        X = variateRejection();
+    } while (X >= down && X <= up && ++iter <= MAX_ITER_REJECTION);
+    return X;
+}
+
+void NegativeHyperGeometricRand::Sample(std::vector<int> &outputData) const
+{
+    /// accumulate probabilities in the same order as variateFromMode() once for all the sample,
+    /// then every variate is found by binary search, values out of table are drawn separately
+    static constexpr size_t MAX_TABLE_SIZE = 1 << 16;
+    size_t size = outputData.size();
+    size_t tableSize = std::min(MAX_TABLE_SIZE, size + 16);
+    int maxVal = MaxValue();
+    std::vector<double> cumulative(1, pMode);
+    std::vector<int> values(1, mode);
+    int up = mode, down = mode;
+    double pUp = pMode, pDown = pMode, sum = pMode;
+    while ((up < maxVal || down > 0) && cumulative.size() < tableSize && sum < 1.0) {
+        if (up < maxVal) {
+            pUp *= ratioToNext(up++);
+            sum += pUp;
+            cumulative.push_back(sum);
+            values.push_back(up);
+        }
+        if (down > 0) {
+            pDown /= ratioToNext(--down);
+            sum += pDown;
+            cumulative.push_back(sum);
+            values.push_back(down);
+        }
+    }
+
+    static constexpr size_t CHUNK_SIZE = 4096;
+    std::vector<double> uniforms(std::min(CHUNK_SIZE, size));
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(chunkSize);
+        U.Sample(uniforms);
+        for (size_t i = 0; i != chunkSize; ++i) {
+            size_t j = std::lower_bound(cumulative.begin(), cumulative.end(), uniforms[i]) - cumulative.begin();
+            outputData[begin + i] = (j < cumulative.size()) ? values[j] : variateOutOfTable(uniforms[i], down, up);
+        }
     }
-    return num - successesNum;
 }
 
 double NegativeHyperGeometricRand::Mean() const
@@ -2,13 +2,16 @@
 #define NEGATIVEHYPERGEOMETRICRAND_H
 
 #include "DiscreteDistribution.h"
-#include "BernoulliRand.h"
 
 /**
  * @brief The NegativeHyperGeometricRand class <BR>
  * Negative hypergeometric distribution
  *
  * Notation: X ~ NHG(N, M, m)
+ *
+ * Variates are generated by sequential search, starting from the mode
+ * and going alternately up and down, if variance is small,
+ * and by Devroye's rejection method for log-concave distributions otherwise
  */
 class RANDLIBSHARED_EXPORT NegativeHyperGeometricRand : public DiscreteDistribution
 {
@@ -16,7 +19,9 @@ class RANDLIBSHARED_EXPORT NegativeHyperGeometricRand : public DiscreteDistribut
     int M = 1; ///< total amount of successes
     int m = 1; ///< limiting number of successes
     double pmfCoef = 1; ///< C(N, M)
-    double p0 = 1; ///< M / N
+    int mode = 0; ///< the most probable value
+    double pMode = 1; ///< P(X = mode)
+    double logPMode = 0; ///< log(P(X = mode))
 
 public:
     NegativeHyperGeometricRand(int totalSize, int totalSuccessesNum, int limitSuccessesNum);
@@ -33,7 +38,46 @@ public:
     double P(const int & k) const override;
     double logP(const int & k) const override;
     double F(const int & k) const override;
+
+private:
+    enum GENERATOR_ID {
+        SEARCH_FROM_MODE,
+        REJECTION
+    };
+
+    GENERATOR_ID GetIdOfUsedGenerator() const;
+
+    /**
+     * @fn ratioToNext
+     * @param k
+     * @return P(X = k + 1) / P(X = k)
+     */
+    double ratioToNext(int k) const;
+
+    /**
+     * @fn variateFromMode
+     * @param U uniform variate on [0, 1]
+     * @return the first value, such that probabilities, accumulated in the order
+     * mode, mode + 1, mode - 1, mode + 2, ..., reach U, or -1 if they don't due to rounding errors
+     */
+    int variateFromMode(double U) const;
+
+    int variateRejection() const;
+
+    /**
+     * @fn variateOutOfTable
+     * @param U uniform variate, which exceeds probabilities, accumulated in table
+     * @param down the smallest value in table
+     * @param up the largest value in table
+     * @return variate, conditioned to be out of [down, up]
+     */
+    int variateOutOfTable(double U, int down, int up) const;
+
+public:
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -172,23 +172,56 @@ int PoissonRand::Variate() const
     return generateByInversion() ? variateInversion() : variateRejection();
 }
 
+PoissonRand::TransformedRejectionConstants::TransformedRejectionConstants(double rateValue) :
+    rate(rateValue),
+    logRate(std::log(rateValue)),
+    b(0.931 + 2.53 * std::sqrt(rateValue)),
+    a(-0.059 + 0.02483 * b),
+    logInvAlpha(std::log(1.1239 + 1.1328 / (b - 3.4))),
+    vr(0.9277 - 3.6224 / (b - 2))
+{
+}
+
+int PoissonRand::variateTransformedRejection(const TransformedRejectionConstants &constants)
+{
+    const double a = constants.a, b = constants.b;
+    int iter = 0;
+    do {
+        double U = UniformRand::StandardVariate() - 0.5;
+        double V = UniformRand::StandardVariate();
+        double us = 0.5 - std::fabs(U);
+        double X = std::floor((2 * a / us + b) * U + constants.rate + 0.43);
+        /// squeeze acceptance
+        if (us >= 0.07 && V <= constants.vr)
+            return X;
+        if (X < 0 || (us < 0.013 && V > us))
+            continue;
+        double logHat = std::log(V) + constants.logInvAlpha - std::log(a / (us * us) + b);
+        if (logHat <= X * constants.logRate - constants.rate - RandMath::lfact(X))
+            return X;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1;
+}
+
+int PoissonRand::variateInversion(double rate)
+{
+    double U = UniformRand::StandardVariate();
+    int k = 0;
+    double p = std::exp(-rate), s = p;
+    while (s < U && p > 0) {
+        ++k;
+        p *= rate / k;
+        s += p;
+    }
+    return k;
+}
+
 int PoissonRand::Variate(double rate)
 {
     /// check validness of parameter
     if (rate <= 0.0)
         return -1;
-    if (rate > 1000) {
-        /// approximate with normal distribution
-        double X = NormalRand::StandardVariate();
-        return std::floor(rate + std::sqrt(rate) * X);
-    }
-    int k = -1;
-    double s = 0;
-    do {
-        s += ExponentialRand::StandardVariate();
-        ++k;
-    } while (s < rate);
-    return k;
+    return (rate < 10) ? variateInversion(rate) : variateTransformedRejection(TransformedRejectionConstants(rate));
 }
 
 void PoissonRand::Sample(std::vector<int> &outputData) const
@@ -203,6 +236,57 @@ void PoissonRand::Sample(std::vector<int> &outputData) const
     }
 }
 
+void PoissonRand::Sample(const double *rates, int *outputData, size_t size)
+{
+    static constexpr size_t CHUNK_SIZE = 4096;
+    std::vector<double> uniforms;
+    std::vector<size_t> largeRateIndices;
+    largeRateIndices.reserve(std::min(CHUNK_SIZE, size));
+    /// cumulative probabilities of the last small rate, extended on demand
+    double tableRate = -1.0, tableProb = 0.0;
+    std::vector<double> table;
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(chunkSize);
+        U.Sample(uniforms);
+        largeRateIndices.clear();
+        for (size_t i = begin; i != begin + chunkSize; ++i) {
+            double rate = rates[i];
+            if (rate <= 0.0) {
+                outputData[i] = -1;
+                continue;
+            }
+            if (rate >= 10) {
+                largeRateIndices.push_back(i);
+                continue;
+            }
+            if (rate != tableRate) {
+                tableRate = rate;
+                tableProb = std::exp(-rate);
+                table.assign(1, tableProb);
+            }
+            double u = uniforms[i - begin];
+            while (table.back() < u && tableProb > 0) {
+                tableProb *= rate / table.size();
+                table.push_back(table.back() + tableProb);
+            }
+            outputData[i] = std::lower_bound(table.begin(), table.end(), u) - table.begin();
+            /// all the table can be less than u only due to rounding errors
+            outputData[i] = std::min(outputData[i], static_cast<int>(table.size()) - 1);
+        }
+        /// large rates are processed together, as they need different amount of uniform variates
+        if (largeRateIndices.empty())
+            continue;
+        TransformedRejectionConstants constants(rates[largeRateIndices[0]]);
+        for (size_t i : largeRateIndices) {
+            if (rates[i] != constants.rate)
+                constants = TransformedRejectionConstants(rates[i]);
+            outputData[i] = variateTransformedRejection(constants);
+        }
+    }
+}
+
 double PoissonRand::Mean() const
 {
     return lambda;
@@ -49,11 +49,48 @@ private:
     int variateRejection() const;
     int variateInversion() const;
 
+    /**
+     * @brief The TransformedRejectionConstants struct
+     * Constants of PTRS algorithm for given rate, which are cheap to set up
+     */
+    struct TransformedRejectionConstants {
+        double rate, logRate;
+        double b, a, logInvAlpha, vr;
+        explicit TransformedRejectionConstants(double rateValue);
+    };
+
+    /**
+     * @fn variateTransformedRejection
+     * @param constants
+     * @return variate by transformed rejection with squeeze of Hörmann (1993), valid for rate ≥ 10
+     */
+    static int variateTransformedRejection(const TransformedRejectionConstants &constants);
+
+    /**
+     * @fn variateInversion
+     * @param rate
+     * @return variate by sequential search from zero, fast for small rate
+     */
+    static int variateInversion(double rate);
+
 public:
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
     static int Variate(double rate);
     void Sample(std::vector<int> &outputData) const;
 
+    /**
+     * @fn Sample
+     * fill array by variates with individual rates:
+     * small rates are handled by inversion with cumulative table, shared by equal consecutive rates,
+     * and the rest by transformed rejection, sharing set up between equal consecutive rates
+     * @param rates
+     * @param outputData
+     * @param size
+     */
+    static void Sample(const double *rates, int *outputData, size_t size);
+
     double Mean() const override;
     double Variance() const override;
     int Median() const override;
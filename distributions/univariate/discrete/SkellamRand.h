@@ -39,6 +39,8 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     double S(const int & k) const override;
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
     void Sample(std::vector<int> &outputData) const override;
 
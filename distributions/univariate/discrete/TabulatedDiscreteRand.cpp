@@ -0,0 +1,149 @@
+#include "TabulatedDiscreteRand.h"
+#include "../continuous/UniformRand.h"
+
+TabulatedDiscreteRand::TabulatedDiscreteRand(const DiscreteDistribution &distribution, double tailProbability)
+{
+    SetDistribution(distribution, tailProbability);
+}
+
+String TabulatedDiscreteRand::Name() const
+{
+    return "Tabulated " + distributionName;
+}
+
+void TabulatedDiscreteRand::SetDistribution(const DiscreteDistribution &distribution, double tailProbability)
+{
+    if (tailProbability <= 0.0 || tailProbability >= 0.5)
+        throw std::invalid_argument("Tabulated distribution: tail probability should be in interval (0, 0.5)");
+    SUPPORT_TYPE suppType = distribution.SupportType();
+    int minValue = (suppType == FINITE_T || suppType == RIGHTSEMIFINITE_T) ? distribution.MinValue() : distribution.Quantile(tailProbability);
+    int maxValue = (suppType == FINITE_T || suppType == LEFTSEMIFINITE_T) ? distribution.MaxValue() : distribution.Quantile1m(tailProbability);
+    if (static_cast<double>(maxValue) - minValue >= MAX_TABLE_SIZE)
+        throw std::invalid_argument("Tabulated distribution: support is too large to be tabulated");
+
+    int size = maxValue - minValue + 1;
+    prob.resize(size);
+    cdf.resize(size);
+    double sum = 0.0;
+    for (int i = 0; i != size; ++i) {
+        prob[i] = distribution.P(minValue + i);
+        if (!(prob[i] >= 0.0))
+            throw std::invalid_argument("Tabulated distribution: probabilities should be non-negative");
+        sum += prob[i];
+        cdf[i] = sum;
+    }
+    if (sum == 0.0)
+        throw std::invalid_argument("Tabulated distribution: probability of support should be positive");
+
+    /// normalize, as tails are truncated, and make sure that search never runs out of table
+    for (int i = 0; i != size; ++i) {
+        prob[i] /= sum;
+        cdf[i] /= sum;
+    }
+    cdf[size - 1] = 1.0;
+
+    /// guide table of the same size as cumulative table
+    guideTable.resize(size);
+    int i = 0;
+    for (int j = 0; j != size; ++j) {
+        double p = static_cast<double>(j) / size;
+        while (cdf[i] < p)
+            ++i;
+        guideTable[j] = i;
+    }
+
+    a = minValue;
+    b = maxValue;
+    distributionName = distribution.Name();
+}
+
+double TabulatedDiscreteRand::P(const int & k) const
+{
+    return (k < a || k > b) ? 0.0 : prob[k - a];
+}
+
+double TabulatedDiscreteRand::logP(const int & k) const
+{
+    return std::log(P(k));
+}
+
+double TabulatedDiscreteRand::F(const int & k) const
+{
+    if (k < a)
+        return 0.0;
+    return (k >= b) ? 1.0 : cdf[k - a];
+}
+
+double TabulatedDiscreteRand::S(const int & k) const
+{
+    if (k < a)
+        return 1.0;
+    return (k >= b) ? 0.0 : 1.0 - cdf[k - a];
+}
+
+int TabulatedDiscreteRand::search(double p) const
+{
+    /// guide table leads to the first candidate, the rest of search takes less than 2 steps on average
+    int size = cdf.size();
+    int j = std::min(static_cast<int>(p * size), size - 1);
+    int i = guideTable[j];
+    while (cdf[i] < p)
+        ++i;
+    return i;
+}
+
+int TabulatedDiscreteRand::Variate() const
+{
+    return a + search(UniformRand::StandardVariate());
+}
+
+void TabulatedDiscreteRand::Sample(std::vector<int> &outputData) const
+{
+    static constexpr size_t CHUNK_SIZE = 4096;
+    size_t size = outputData.size();
+    std::vector<double> uniforms(std::min(CHUNK_SIZE, size));
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(chunkSize);
+        U.Sample(uniforms);
+        for (size_t i = 0; i != chunkSize; ++i)
+            outputData[begin + i] = a + search(uniforms[i]);
+    }
+}
+
+double TabulatedDiscreteRand::Mean() const
+{
+    double sum = 0.0;
+    for (size_t i = 1; i < prob.size(); ++i)
+        sum += i * prob[i];
+    return a + sum;
+}
+
+double TabulatedDiscreteRand::Variance() const
+{
+    /// moments are centered at a for better precision
+    double mean = 0.0, secMom = 0.0;
+    for (size_t i = 1; i < prob.size(); ++i) {
+        double aux = i * prob[i];
+        mean += aux;
+        secMom += i * aux;
+    }
+    return secMom - mean * mean;
+}
+
+int TabulatedDiscreteRand::Mode() const
+{
+    auto maxProbIt = std::max_element(prob.begin(), prob.end());
+    return a + std::distance(prob.begin(), maxProbIt);
+}
+
+int TabulatedDiscreteRand::quantileImpl(double p) const
+{
+    return a + search(p);
+}
+
+int TabulatedDiscreteRand::quantileImpl1m(double p) const
+{
+    return a + search(1.0 - p);
+}
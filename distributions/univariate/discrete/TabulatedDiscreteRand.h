@@ -0,0 +1,68 @@
+#ifndef TABULATEDDISCRETERAND_H
+#define TABULATEDDISCRETERAND_H
+
+#include "DiscreteDistribution.h"
+
+/**
+ * @brief The TabulatedDiscreteRand class <BR>
+ * Distribution, tabulated from any discrete distribution on its support,
+ * truncated to [Quantile(ε), Quantile1m(ε)] if it is infinite
+ *
+ * P(X = k) = P(Y = k) / P(Y ∈ [a, b]) for a <= k <= b
+ *
+ * Variates and quantiles are found by inversion of cumulative table,
+ * which is accelerated by guide table of Chen and Asau, hence they take O(1) expected time
+ *
+ * Notation: X ~ Tab(Y)
+ */
+class RANDLIBSHARED_EXPORT TabulatedDiscreteRand : public DiscreteDistribution
+{
+    String distributionName = "";
+    int a = 0; ///< min bound
+    int b = 0; ///< max bound
+    std::vector<double> prob{1.0}; ///< P(X = a + i)
+    std::vector<double> cdf{1.0}; ///< P(X ≤ a + i)
+    std::vector<int> guideTable{0}; ///< the smallest i, such that P(X ≤ a + i) ≥ j / m, for j = 0, ..., m - 1
+
+    static constexpr int MAX_TABLE_SIZE = 1 << 24;
+
+public:
+    /**
+     * @fn TabulatedDiscreteRand
+     * @param distribution
+     * @param tailProbability ε, probability of tails, dropped from infinite support
+     */
+    explicit TabulatedDiscreteRand(const DiscreteDistribution &distribution, double tailProbability = 1e-14);
+    String Name() const override;
+    SUPPORT_TYPE SupportType() const override { return FINITE_T; }
+    int MinValue() const override { return a; }
+    int MaxValue() const override { return b; }
+
+    void SetDistribution(const DiscreteDistribution &distribution, double tailProbability = 1e-14);
+
+    double P(const int & k) const override;
+    double logP(const int & k) const override;
+    double F(const int & k) const override;
+    double S(const int & k) const override;
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
+    int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
+
+    double Mean() const override;
+    double Variance() const override;
+    int Mode() const override;
+
+private:
+    /**
+     * @fn search
+     * @param p
+     * @return the smallest i, such that P(X ≤ a + i) ≥ p
+     */
+    int search(double p) const;
+
+    int quantileImpl(double p) const override;
+    int quantileImpl1m(double p) const override;
+};
+
+#endif // TABULATEDDISCRETERAND_H
@@ -35,6 +35,7 @@ public:
     double logP(const int & k) const override;
     double F(const int & k) const override;
     double S(const int & k) const override;
+    using DiscreteDistribution::Variate;
     int Variate() const override;
     static int Variate(double shape);
 
@@ -23,17 +23,40 @@ void ZipfRand::SetParameters(double exponent, int number)
 
     invHarmonicNumber = 1.0 / RandMath::harmonicNumber(s, n);
 
-    // WARNING: we calculate pow here and in invHarmonic number
-    hashedVarNum = n > tableSize ? tableSize : n;
-    table[0] = 1.0;
-    for (int i = 1; i < hashedVarNum - 1; ++i)
-        table[i] = table[i - 1] + std::pow(i + 1, -s);
-    if (hashedVarNum == n)
-        table[hashedVarNum - 1] = 1.0 / invHarmonicNumber;
-    else
-        table[hashedVarNum - 1] = table[hashedVarNum - 2] + std::pow(hashedVarNum, -s);
-    for (int i = 0; i < hashedVarNum; ++i)
-        table[i] *= invHarmonicNumber;
+    hIntegralX1 = hIntegral(1.5) - 1.0;
+    hIntegralN = hIntegral(n + 0.5);
+    squeeze = 2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0));
+}
+
+double ZipfRand::h(double x) const
+{
+    return std::exp(-s * std::log(x));
+}
+
+double ZipfRand::hIntegral(double x) const
+{
+    /// (x^(1 - s) - 1) / (1 - s) = log(x) * expm1(t) / t with t = (1 - s) log(x)
+    double logX = std::log(x);
+    double t = (1.0 - s) * logX;
+    double expm1tDivt = (std::fabs(t) > 1e-8) ? std::expm1(t) / t : 1.0 + 0.5 * t * (1.0 + t / 3.0 * (1.0 + 0.25 * t));
+    return expm1tDivt * logX;
+}
+
+double ZipfRand::hIntegralInverse(double x) const
+{
+    /// (1 + (1 - s) x)^(1 / (1 - s)) = exp(x * log1p(t) / t) with t = (1 - s) x
+    double t = std::max(x * (1.0 - s), -1.0);
+    double log1ptDivt = (std::fabs(t) > 1e-8) ? std::log1p(t) / t : 1.0 - t * (0.5 - t * (1.0 / 3.0 - 0.25 * t));
+    return std::exp(log1ptDivt * x);
+}
+
+bool ZipfRand::acceptRejectionInversion(double U, int &k) const
+{
+    double u = hIntegralN + U * (hIntegralX1 - hIntegralN);
+    double x = hIntegralInverse(u);
+    /// x can be beyond [0.5, n + 0.5] only due to rounding errors
+    k = std::min(std::max(static_cast<int>(x + 0.5), 1), n);
+    return (k - x <= squeeze || u >= hIntegral(k + 0.5) - h(k));
 }
 
 double ZipfRand::P(const int & k) const
@@ -55,24 +78,63 @@ double ZipfRand::F(const int & k) const
     return RandMath::harmonicNumber(s, k) * invHarmonicNumber;
 }
 
+void ZipfRand::CumulativeDistributionFunction(const std::vector<int> &x, std::vector<double> &y) const
+{
+    /// close points continue previous sum term by term, distant ones are evaluated from scratch
+    static constexpr int MAX_GAP = 16;
+    size_t size = x.size();
+    if (size > y.size())
+        return;
+    int lastK = 0;
+    double sum = 0.0;
+    for (size_t i = 0; i != size; ++i) {
+        int k = x[i];
+        if (k < 1)
+            y[i] = 0.0;
+        else if (k >= n)
+            y[i] = 1.0;
+        else {
+            if (k >= lastK && k - lastK <= MAX_GAP) {
+                for (int j = lastK + 1; j <= k; ++j)
+                    sum += std::pow(j, -s);
+            }
+            else
+                sum = RandMath::harmonicNumber(s, k);
+            lastK = k;
+            y[i] = sum * invHarmonicNumber;
+        }
+    }
+}
+
 int ZipfRand::Variate() const
 {
-    double U = UniformRand::StandardVariate();
+    /// rejection-inversion: invert integral of the hat x^(-s),
+    /// the area of hat over [k - 0.5, k + 0.5] is not smaller than k^(-s)
+    int iter = 0;
     int k = 1;
-    /// if we didn't manage to hash values for such U
-    if (U > table[hashedVarNum - 1]) {
-        k = hashedVarNum;
-        double sum = table[hashedVarNum - 1];
-        do {
-            ++k;
-            sum += std::pow(k, -s) * invHarmonicNumber;
-        } while (sum < U);
-    }
-    else {
-        while (k <= hashedVarNum && table[k - 1] < U)
-            ++k;
+    do {
+        if (acceptRejectionInversion(UniformRand::StandardVariate(), k))
+            return k;
+    } while (++iter <= MAX_ITER_REJECTION);
+    return -1; /// fail due to some error
+}
+
+void ZipfRand::Sample(std::vector<int> &outputData) const
+{
+    /// uniform variates are generated in bulk, rare rejected candidates are replaced by single variates
+    static constexpr size_t CHUNK_SIZE = 4096;
+    size_t size = outputData.size();
+    std::vector<double> uniforms(std::min(CHUNK_SIZE, size));
+    UniformRand U;
+    for (size_t begin = 0; begin < size; begin += CHUNK_SIZE) {
+        size_t chunkSize = std::min(CHUNK_SIZE, size - begin);
+        uniforms.resize(chunkSize);
+        U.Sample(uniforms);
+        for (size_t i = 0; i != chunkSize; ++i) {
+            int k = 1;
+            outputData[begin + i] = acceptRejectionInversion(uniforms[i], k) ? k : Variate();
+        }
     }
-    return k;
 }
 
 double ZipfRand::Mean() const
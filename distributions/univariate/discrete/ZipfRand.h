@@ -9,6 +9,9 @@
  * Zipf distribution
  *
  * Notation: X ~ Zipf(s, n)
+ *
+ * Variates are generated by rejection-inversion of Hörmann and Derflinger
+ * in O(1) expected time for any s and n
  */
 class RANDLIBSHARED_EXPORT ZipfRand : public DiscreteDistribution
 {
@@ -16,9 +19,9 @@ class RANDLIBSHARED_EXPORT ZipfRand : public DiscreteDistribution
     int n = 1; ///< number
     double invHarmonicNumber = 1; /// 1 / H(s, n)
 
-    static constexpr int tableSize = 16;
-    int hashedVarNum = 1;
-    double table[tableSize];
+    double hIntegralX1 = 0; ///< H(1.5) - 1, where H is integral of hat function
+    double hIntegralN = 0; ///< H(n + 0.5)
+    double squeeze = 0; ///< k - x ≤ squeeze guarantees acceptance
 
 public:
     ZipfRand(double exponent, int number);
@@ -34,7 +37,17 @@ public:
     double P(const int & k) const override;
     double logP(const int & k) const override;
     double F(const int & k) const override;
+    /**
+     * @fn CumulativeDistributionFunction
+     * fill vector y by F(x), partial sums are reused when x is sorted
+     * @param x
+     * @param y
+     */
+    void CumulativeDistributionFunction(const std::vector<int> &x, std::vector<double> &y) const override;
+    using DiscreteDistribution::Variate;
+    using DiscreteDistribution::Sample;
     int Variate() const override;
+    void Sample(std::vector<int> &outputData) const override;
 
     double Mean() const override;
     double Variance() const override;
@@ -43,6 +56,35 @@ public:
     double ExcessKurtosis() const override;
 
 private:
+    /**
+     * @fn h
+     * @param x
+     * @return hat function x^(-s)
+     */
+    double h(double x) const;
+
+    /**
+     * @fn hIntegral
+     * @param x
+     * @return antiderivative of hat function (x^(1 - s) - 1) / (1 - s)
+     */
+    double hIntegral(double x) const;
+
+    /**
+     * @fn hIntegralInverse
+     * @param x
+     * @return inverse function of hIntegral
+     */
+    double hIntegralInverse(double x) const;
+
+    /**
+     * @fn acceptRejectionInversion
+     * @param U uniform variate on [0, 1]
+     * @param k candidate to return
+     * @return true if candidate, generated by U, is accepted
+     */
+    bool acceptRejectionInversion(double U, int &k) const;
+
     std::complex<double> CFImpl(double t) const override;
 };
 
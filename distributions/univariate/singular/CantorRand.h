@@ -25,6 +25,7 @@ public:
     double MaxValue() const override { return 1; }
 
     double F(const double & x) const override;
+    using SingularDistribution::Variate;
     double Variate() const override;
 
     double Mean() const override;
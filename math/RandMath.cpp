@@ -193,9 +193,43 @@ double harmonicNumber(double exponent, int number)
         return M_EULER + digamma(number + 1);
     if (exponent == 2)
         return M_PI_SQ / 6.0 - trigamma(number + 1);
+    /// first terms are summed directly, the tail needs to start far enough for asymptotics to work
+    int start = 16 + static_cast<int>(std::min(std::fabs(exponent), 1e6));
     double res = 1.0;
-    for (int i = 2; i <= number; ++i)
+    int directEnd = std::min(number, start - 1);
+    for (int i = 2; i <= directEnd; ++i)
         res += std::pow(i, -exponent);
+    if (number < start)
+        return res;
+
+    /// Euler-Maclaurin formula for sum_{i=start}^{number} i^{-exponent}:
+    /// integral + half of the boundary terms + corrections with Bernoulli numbers
+    double a = start, b = number;
+    double logRatio = std::log(b / a);
+    double t = (1.0 - exponent) * logRatio;
+    double expm1tDivt = (std::fabs(t) > 1e-8) ? std::expm1(t) / t : 1.0 + 0.5 * t * (1.0 + t / 3.0 * (1.0 + 0.25 * t));
+    double powA = std::pow(a, -exponent), powB = std::pow(b, -exponent);
+    res += a * powA * logRatio * expm1tDivt;
+    res += 0.5 * (powA + powB);
+
+    /// B_{2j} / (2j)!
+    static constexpr double BERNOULLI_COEF[] = {
+        1.0 / 12, -1.0 / 720, 1.0 / 30240, -1.0 / 1209600,
+        1.0 / 47900160, -691.0 / 1307674368000, 1.0 / 74724249600, -3617.0 / 10670622842880000
+    };
+    /// derivative of order 2j - 1 is -exponent (exponent + 1) ... (exponent + 2j - 2) x^{-exponent - 2j + 1}
+    double pochhammer = exponent;
+    double derivA = powA / a, derivB = powB / b;
+    double invASq = 1.0 / (a * a), invBSq = 1.0 / (b * b);
+    for (int j = 1; j <= 8; ++j) {
+        double term = BERNOULLI_COEF[j - 1] * pochhammer * (derivA - derivB);
+        res += term;
+        if (std::fabs(term) <= MIN_POSITIVE * std::fabs(res))
+            break;
+        pochhammer *= (exponent + 2 * j - 1) * (exponent + 2 * j);
+        derivA *= invASq;
+        derivB *= invBSq;
+    }
     return res;
 }
 
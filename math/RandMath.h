@@ -92,7 +92,8 @@ double xexpxsqerfc(double x);
  * @fn harmonicNumber
  * @param exponent
  * @param number
- * @return sum_{i=1}^{number} i^{-exponent}
+ * @return sum_{i=1}^{number} i^{-exponent},
+ * evaluated in O(1) time by Euler-Maclaurin formula for large number
  */
 double harmonicNumber(double exponent, int number);
 